@@ -8,8 +8,8 @@
 #ifndef POWSYBL_IIDM_ABSTRACTCOMPONENTSMANAGER_HPP
 #define POWSYBL_IIDM_ABSTRACTCOMPONENTSMANAGER_HPP
 
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <powsybl/iidm/Component.hpp>
@@ -54,9 +54,9 @@ public:
     void update();
 
 protected:
-    void addToAdjacencyList(const stdcxx::CReference<Bus>& bus1, const stdcxx::CReference<Bus>& bus2, const std::map<std::string, unsigned long>& id2num, std::vector<std::vector<unsigned long>>& adjacencyList) const;
+    void addToAdjacencyList(const stdcxx::CReference<Bus>& bus1, const stdcxx::CReference<Bus>& bus2, const std::unordered_map<const Bus*, unsigned long>& bus2num, std::vector<std::vector<unsigned long>>& adjacencyList) const;
 
-    virtual void fillAdjacencyList(const std::map<std::string, unsigned long>& id2num, std::vector<std::vector<unsigned long>>& adjacencyList) const;
+    virtual void fillAdjacencyList(const std::unordered_map<const Bus*, unsigned long>& bus2num, std::vector<std::vector<unsigned long>>& adjacencyList) const;
 
     const Network& getNetwork() const;
 
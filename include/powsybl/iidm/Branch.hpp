@@ -8,6 +8,7 @@
 #ifndef POWSYBL_IIDM_BRANCH_HPP
 #define POWSYBL_IIDM_BRANCH_HPP
 
+#include <functional>
 #include <iosfwd>
 
 #include <powsybl/iidm/Connectable.hpp>
@@ -47,7 +48,7 @@ public:
     private:
         CurrentLimits::TemporaryLimit m_temporaryLimit;
 
-        std::string m_previousLimitName;
+        std::reference_wrapper<const std::string> m_previousLimitName;
 
         double m_previousLimit;
     };
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_BUSVIEWSNAPSHOT_HPP
+#define POWSYBL_IIDM_BUSVIEWSNAPSHOT_HPP
+
+#include <string>
+#include <vector>
+
+#include <powsybl/stdcxx/reference.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Network;
+
+/**
+ * An immutable copy of the bus view of a network, taken in the working variant.
+ *
+ * A snapshot does not reference the network, so it can be shared (for instance as a std::shared_ptr<const
+ * BusViewSnapshot>) with readers running on other threads while the network keeps being modified. Its topology is
+ * outdated as soon as the topology generation of the network differs from the one of the snapshot.
+ */
+class BusViewSnapshot {
+public:
+    class Bus {
+    public:
+        Bus(std::string id, std::string voltageLevelId, double v, double angle, std::vector<std::string>&& connectableIds);
+
+        double getAngle() const;
+
+        /**
+         * Return the ids of the connectables having a terminal connected to this bus
+         */
+        const std::vector<std::string>& getConnectableIds() const;
+
+        const std::string& getId() const;
+
+        double getV() const;
+
+        const std::string& getVoltageLevelId() const;
+
+    private:
+        std::string m_id;
+
+        std::string m_voltageLevelId;
+
+        double m_v;
+
+        double m_angle;
+
+        std::vector<std::string> m_connectableIds;
+    };
+
+public:
+    explicit BusViewSnapshot(const Network& network);
+
+    /**
+     * Return the bus with the given id, or an invalid reference if the bus view had no such bus
+     */
+    stdcxx::CReference<Bus> getBus(const std::string& id) const;
+
+    /**
+     * Return the buses sorted by id
+     */
+    const std::vector<Bus>& getBuses() const;
+
+    unsigned long getTopologyGeneration() const;
+
+    unsigned long getVariantIndex() const;
+
+    /**
+     * Return true if the topology of the given network has not changed since this snapshot was taken, and if the
+     * snapshot was taken in its working variant
+     */
+    bool isUpToDate(const Network& network) const;
+
+private:
+    unsigned long m_topologyGeneration;
+
+    unsigned long m_variantIndex;
+
+    std::vector<Bus> m_buses;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_BUSVIEWSNAPSHOT_HPP
@@ -21,7 +21,7 @@ public:
     ConnectedComponentsManager(Network& network, ConnectedComponentsManager&& manager) noexcept;
 
 protected:  // AbstractComponentsManager
-    void fillAdjacencyList(const std::map<std::string, unsigned long>& id2num, std::vector<std::vector<unsigned long>>& adjacencyList) const override;
+    void fillAdjacencyList(const std::unordered_map<const Bus*, unsigned long>& bus2num, std::vector<std::vector<unsigned long>>& adjacencyList) const override;
 
     void setComponentNumber(Bus& bus, const stdcxx::optional<unsigned long>& num) override;
 
@@ -8,11 +8,10 @@
 #ifndef POWSYBL_IIDM_EXTENDABLE_HPP
 #define POWSYBL_IIDM_EXTENDABLE_HPP
 
-#include <map>
 #include <memory>
 #include <string>
-#include <typeindex>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <powsybl/iidm/Extension.hpp>
 #include <powsybl/iidm/ExtensionAdder.hpp>
@@ -74,9 +73,29 @@ public:
     void removeExtension();
 
 private:
-    std::map<std::string, std::unique_ptr<Extension> > m_extensionsByName;
+    const Extension* findExtensionByName(const std::string& name) const;
 
-    std::unordered_map<std::type_index, std::reference_wrapper<Extension> > m_extensionsByType;
+    const Extension* findExtensionBySlot(unsigned long slot) const;
+
+    /**
+     * Called once the extension has been added to this object
+     */
+    virtual void onExtensionAdded(unsigned long slot, Extension& extension);
+
+    /**
+     * Called before the extension is removed from this object
+     */
+    virtual void onExtensionRemoved(unsigned long slot, Extension& extension);
+
+    void removeExtensionBySlot(unsigned long slot);
+
+private:
+    using ExtensionSlot = std::pair<unsigned long, std::unique_ptr<Extension> >;
+
+private:
+    // The extensions sorted by name, with the slot of their type. An object rarely has more than a few extensions, and
+    // an empty vector does not allocate.
+    std::vector<ExtensionSlot> m_extensions;
 };
 
 }  // namespace iidm
@@ -19,35 +19,24 @@ namespace iidm {
 
 template <typename E, typename>
 stdcxx::CReference<E> Extendable::findExtension() const {
-    stdcxx::CReference<E> extension;
+    // The type of the extensions in the slot of E is E: no need to check the cast
+    const Extension* extension = findExtensionBySlot(Extension::getSlot<E>());
 
-    const auto& it = m_extensionsByType.find(typeid(E));
-    if (it != m_extensionsByType.end()) {
-        extension = stdcxx::cref(dynamic_cast<const E&>(it->second.get()));
-    }
-
-    return extension;
+    return extension != nullptr ? stdcxx::cref<E>(static_cast<const E&>(*extension)) : stdcxx::cref<E>();
 }
 
 template <typename E, typename>
 stdcxx::Reference<E> Extendable::findExtension() {
-    stdcxx::Reference<E> extension;
-
-    const auto& it = m_extensionsByType.find(typeid(E));
-    if (it != m_extensionsByType.end()) {
-        extension = stdcxx::ref(dynamic_cast<E&>(it->second.get()));
-    }
-
-    return extension;
+    return stdcxx::ref(static_cast<const Extendable*>(this)->findExtension<E>());
 }
 
 template <typename E, typename>
 const E& Extendable::getExtension() const {
-    const auto& it = m_extensionsByType.find(typeid(E));
-    if (it == m_extensionsByType.end()) {
+    const Extension* extension = findExtensionBySlot(Extension::getSlot<E>());
+    if (extension == nullptr) {
         throw PowsyblException(stdcxx::format("Extension %1% not found", stdcxx::demangle<E>()));
     }
-    return dynamic_cast<E&>(it->second.get());
+    return static_cast<const E&>(*extension);
 }
 
 template <typename E, typename>
@@ -57,9 +46,9 @@ E& Extendable::getExtension() {
 
 template <typename E, typename>
 stdcxx::CReference<E> Extendable::getExtensionByName(const std::string& name) const {
-    auto it = m_extensionsByName.find(name);
-    if (it != m_extensionsByName.end() && stdcxx::isInstanceOf<E>(*it->second)) {
-        return stdcxx::cref<E>(dynamic_cast<const E&>(*it->second));
+    const Extension* extension = findExtensionByName(name);
+    if (extension != nullptr && stdcxx::isInstanceOf<E>(*extension)) {
+        return stdcxx::cref<E>(dynamic_cast<const E&>(*extension));
     }
     return stdcxx::cref<E>();
 }
@@ -76,11 +65,7 @@ Adder Extendable::newExtension() {
 
 template <typename E, typename>
 void Extendable::removeExtension() {
-    const auto& it = m_extensionsByType.find(typeid(E));
-    if (it != m_extensionsByType.end()) {
-        m_extensionsByName.erase(it->second.get().getName());
-        m_extensionsByType.erase(it);
-    }
+    removeExtensionBySlot(Extension::getSlot<E>());
 }
 
 }  // namespace iidm
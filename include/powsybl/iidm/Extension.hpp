@@ -22,6 +22,16 @@ namespace iidm {
 class Extendable;
 
 class Extension {
+public:
+    /**
+     * Return the slot of the extension type E: a small integer, unique per extension type, used by the extendables
+     * and the network to find the extensions without hashing their type.
+     */
+    template <typename E, typename = typename std::enable_if<std::is_base_of<Extension, E>::value>::type>
+    static unsigned long getSlot();
+
+    static unsigned long getSlot(const std::type_index& type);
+
 public:
     Extension() = delete;
 
@@ -20,6 +20,13 @@ namespace powsybl {
 
 namespace iidm {
 
+template <typename E, typename>
+unsigned long Extension::getSlot() {
+    // The slot of a type is only looked up once
+    static const unsigned long s_slot = getSlot(typeid(E));
+    return s_slot;
+}
+
 template <typename E, typename>
 stdcxx::CReference<E> Extension::getExtendable() const {
     if (m_extendable && !stdcxx::isInstanceOf<E>(m_extendable.get())) {
@@ -8,6 +8,7 @@
 #ifndef POWSYBL_IIDM_IDENTIFIABLE_HPP
 #define POWSYBL_IIDM_IDENTIFIABLE_HPP
 
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -16,7 +17,6 @@
 #include <powsybl/iidm/IdentifiableType.hpp>
 #include <powsybl/iidm/MultiVariantObject.hpp>
 #include <powsybl/iidm/Validable.hpp>
-#include <powsybl/stdcxx/Properties.hpp>
 #include <powsybl/stdcxx/optional.hpp>
 #include <powsybl/stdcxx/range.hpp>
 
@@ -33,7 +33,7 @@ public: // Validable
 public:
     Identifiable(const Identifiable&) = delete;
 
-    // NOLINTNEXTLINE(performance-noexcept-move-constructor): move constructor of stdcxx::Properties is not marked noexcept
+    // NOLINTNEXTLINE(performance-noexcept-move-constructor): move constructor of std::map is not marked noexcept
     Identifiable(Identifiable&&) = default;  // NOSONAR
 
     ~Identifiable() noexcept override = default;
@@ -106,9 +106,27 @@ protected:  // MultiVariantObject
 protected:
     Identifiable(const std::string& id, const std::string& name, bool fictitious);
 
+    /**
+     * Notify the listeners of the network that an attribute of this identifiable has been updated. Nothing is notified
+     * if the value did not change, and the attribute name is only converted to a string if the network has listeners.
+     */
+    void notifyUpdate(const char* attribute, unsigned long variantIndex, double oldValue, double newValue);
+
+private:  // Extendable
+    void onExtensionAdded(unsigned long slot, Extension& extension) override;
+
+    void onExtensionRemoved(unsigned long slot, Extension& extension) override;
+
 private:
     virtual const std::string& getTypeDescription() const = 0;
 
+private:
+    // The property keys and alias types are repeated over many identifiables: they are interned in the StringPool of
+    // the network
+    using InternedString = std::reference_wrapper<const std::string>;
+
+    using InternedStringLess = std::less<std::string>;
+
 private:
     std::string m_id;
 
@@ -116,11 +134,11 @@ private:
 
     bool m_fictitious;
 
-    stdcxx::Properties m_properties;
+    std::map<InternedString, std::string, InternedStringLess> m_properties;
 
     std::set<std::string> m_aliasesWithoutType;
 
-    std::map<std::string, std::string> m_aliasesByType;
+    std::map<InternedString, std::string, InternedStringLess> m_aliasesByType;
 };
 
 std::ostream& operator<<(std::ostream& stream, const Identifiable& identifiable);
@@ -25,6 +25,10 @@ class OperationalLimitsOwner;
 
 class LoadingLimits : public OperationalLimits {
 public:
+    /**
+     * The name of a temporary limit is not copied: it is interned in the {@link StringPool} of the network by the
+     * adders, and must outlive the limit.
+     */
     class TemporaryLimit {
     public:
         TemporaryLimit(const std::string& name, double value, unsigned long acceptableDuration, bool hasOverloadingProtection);
@@ -40,7 +44,7 @@ public:
         bool isFictitious() const;
 
     private:
-        std::string m_name;
+        std::reference_wrapper<const std::string> m_name;
 
         double m_value;
 
@@ -58,8 +62,7 @@ public:
 
     LoadingLimits(const LoadingLimits&) = default;
 
-    // NOLINTNEXTLINE(performance-noexcept-move-constructor): move constructor of std::map is not marked noexcept
-    LoadingLimits(LoadingLimits&&) = default;  // NOSONAR
+    LoadingLimits(LoadingLimits&&) noexcept = default;
 
     ~LoadingLimits() override = default;
 
@@ -88,9 +91,11 @@ public:
 private:
     double m_permanentLimit;
 
-    TemporaryLimits m_temporaryLimits;
+    // Sorted by decreasing acceptable duration
+    std::vector<TemporaryLimit> m_temporaryLimits;
 
-    FictitiousLimits m_fictitiousLimits;
+    // Sorted by decreasing name
+    std::vector<TemporaryLimit> m_fictitiousLimits;
 };
 
 }  // namespace iidm
@@ -15,6 +15,7 @@
 #include <boost/range/adaptor/map.hpp>
 
 #include <powsybl/iidm/OperationalLimitsOwner.hpp>
+#include <powsybl/iidm/StringPool.hpp>
 #include <powsybl/iidm/ValidationException.hpp>
 #include <powsybl/iidm/ValidationUtils.hpp>
 #include <powsybl/logging/Logger.hpp>
@@ -98,10 +99,11 @@ LoadingLimitsAdder<L, A>::LoadingLimitsAdder(OperationalLimitsOwner& owner) :
 
 template <typename L, typename A>
 LoadingLimitsAdder<L, A>& LoadingLimitsAdder<L, A>::addTemporaryLimit(const std::string& name, double value, unsigned long acceptableDuration, bool fictitious) {
+    const std::string& internedName = m_owner.getStringPool().intern(name);
     if (fictitious && acceptableDuration == std::numeric_limits<unsigned long>::max()) {
-        m_fictitiousLimits.emplace(name, LoadingLimits::TemporaryLimit(name, value, acceptableDuration, fictitious));
+        m_fictitiousLimits.emplace(internedName, LoadingLimits::TemporaryLimit(internedName, value, acceptableDuration, fictitious));
     } else {
-        m_temporaryLimits.emplace(acceptableDuration, LoadingLimits::TemporaryLimit(name, value, acceptableDuration, fictitious));
+        m_temporaryLimits.emplace(acceptableDuration, LoadingLimits::TemporaryLimit(internedName, value, acceptableDuration, fictitious));
     }
     return *this;
 }
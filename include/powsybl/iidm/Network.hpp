@@ -8,12 +8,17 @@
 #ifndef POWSYBL_IIDM_NETWORK_HPP
 #define POWSYBL_IIDM_NETWORK_HPP
 
+#include <set>
+#include <string>
+
 #include <boost/filesystem/path.hpp>
 
 #include <powsybl/iidm/Container.hpp>
 #include <powsybl/iidm/NetworkIndex.hpp>
+#include <powsybl/iidm/NetworkListenerList.hpp>
 #include <powsybl/iidm/NetworkVariant.hpp>
 #include <powsybl/iidm/NetworkViews.hpp>
+#include <powsybl/iidm/StringPool.hpp>
 #include <powsybl/iidm/SubstationAdder.hpp>
 #include <powsybl/iidm/VariantArray.hpp>
 #include <powsybl/iidm/VariantManager.hpp>
@@ -57,6 +62,8 @@ class VoltageLevel;
 class VoltageLevelAdder;
 class VscConverterStation;
 
+class NetworkListener;
+
 class Network : public Container, public VariantManagerHolder {
 public:
     using BusBreakerView = network::BusBreakerView;
@@ -99,8 +106,16 @@ public:
 
     Network& operator=(Network&&) noexcept = delete;
 
+    void addListener(NetworkListener& listener);
+
     template <typename T>
-    T& checkAndAdd(std::unique_ptr<T>&& identifiable);
+    T& checkAndAdd(NetworkIndex::Ptr<T>&& identifiable);
+
+    /**
+     * Create an identifiable in the memory arena of this network, before adding it with {@link Network::checkAndAdd}.
+     */
+    template <typename T, typename... Args>
+    NetworkIndex::Ptr<T> createIdentifiable(Args&&... args);
 
     template <typename T = Identifiable, typename = typename std::enable_if<std::is_base_of<Identifiable, T>::value>::type>
     stdcxx::CReference<T> find(const std::string& id) const;
@@ -185,6 +200,15 @@ public:
 
     stdcxx::range<DanglingLine> getDanglingLines();
 
+    /**
+     * Return the identifiables having an extension of type E, sorted by id, without scanning the whole network
+     */
+    template <typename E, typename = typename std::enable_if<std::is_base_of<Extension, E>::value>::type>
+    stdcxx::const_range<Identifiable> getExtendedIdentifiables() const;
+
+    template <typename E, typename = typename std::enable_if<std::is_base_of<Extension, E>::value>::type>
+    stdcxx::range<Identifiable> getExtendedIdentifiables();
+
     int getForecastDistance() const;
 
     const Generator& getGenerator(const std::string& id) const;
@@ -249,6 +273,8 @@ public:
 
     stdcxx::range<Line> getLines();
 
+    const NetworkListenerList& getListeners() const;
+
     const Load& getLoad(const std::string& id) const;
 
     Load& getLoad(const std::string& id);
@@ -285,6 +311,10 @@ public:
 
     stdcxx::range<StaticVarCompensator> getStaticVarCompensators();
 
+    const StringPool& getStringPool() const;
+
+    StringPool& getStringPool();
+
     const Substation& getSubstation(const std::string& id) const;
 
     Substation& getSubstation(const std::string& id);
@@ -319,6 +349,12 @@ public:
 
     stdcxx::range<ThreeWindingsTransformer> getThreeWindingsTransformers();
 
+    /**
+     * Return a counter incremented each time the calculated topology of one of the voltage levels of this network is
+     * invalidated: switch operations, connections, disconnections, additions and removals of equipments.
+     */
+    unsigned long getTopologyGeneration() const;
+
     const TwoWindingsTransformer& getTwoWindingsTransformer(const std::string& id) const;
 
     TwoWindingsTransformer& getTwoWindingsTransformer(const std::string& id);
@@ -349,6 +385,11 @@ public:
 
     stdcxx::range<VscConverterStation> getVscConverterStations();
 
+    /**
+     * Return true if a {@link TopologyBatch} is opened on this network.
+     */
+    bool isInTopologyBatch() const;
+
     HvdcLineAdder newHvdcLine();
 
     LineAdder newLine();
@@ -363,8 +404,19 @@ public:
 
     VoltageLevelAdder newVoltageLevel();
 
+    /**
+     * Compute the bus/breaker view and the bus view of all the voltage levels in the working variant, sharing the
+     * voltage levels between the given number of threads, then fill the bus caches of the network. Otherwise, the
+     * topology of each voltage level is computed on first access.
+     *
+     * The network must not be accessed by other threads during the computation.
+     */
+    void precomputeTopology(unsigned long threadCount = 1);
+
     void remove(Identifiable& identifiable);
 
+    void removeListener(NetworkListener& listener);
+
     Network& setCaseDate(const stdcxx::DateTime& caseDate);
 
     Network& setForecastDistance(int forecastDistance);
@@ -397,12 +449,26 @@ private:
 
     NetworkIndex& getIndex();
 
+    void beginTopologyBatch();
+
+    void commitTopologyBatch();
+
+    void deferCacheInvalidation(const VoltageLevel& voltageLevel);
+
+    void flushCacheInvalidations();
+
+    void incrementTopologyGeneration();
+
+    void invalidateTopologyCache();
+
     friend class Identifiable;
 
     friend class VoltageLevel;
 
     friend class NodeBreakerVoltageLevel;
 
+    friend class TopologyBatch;
+
     friend class network::BusView;
 
     friend class network::BusBreakerView;
@@ -414,12 +480,24 @@ private:
 
     std::string m_sourceFormat;
 
+    StringPool m_stringPool;
+
     NetworkIndex m_networkIndex;
 
+    NetworkListenerList m_listeners;
+
     VariantManager m_variantManager;
 
     network::VariantArray m_variants;
 
+    unsigned long m_topologyGeneration = 0;
+
+    // Nesting depth of the opened topology batches
+    unsigned long m_topologyBatchDepth = 0;
+
+    // Voltage levels with a deferred invalidation, flushed when the outermost batch commits
+    std::set<std::string> m_batchedVoltageLevelIds;
+
     BusBreakerView m_busBreakerView;
 
     BusView m_busView;
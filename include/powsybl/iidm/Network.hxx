@@ -20,10 +20,15 @@ namespace powsybl {
 namespace iidm {
 
 template <typename T>
-T& Network::checkAndAdd(std::unique_ptr<T>&& identifiable) {
+T& Network::checkAndAdd(NetworkIndex::Ptr<T>&& identifiable) {
     return m_networkIndex.checkAndAdd(std::move(identifiable));
 }
 
+template <typename T, typename... Args>
+NetworkIndex::Ptr<T> Network::createIdentifiable(Args&&... args) {
+    return m_networkIndex.create<T>(std::forward<Args>(args)...);
+}
+
 template <typename T, typename>
 const T& Network::get(const std::string& id) const {
     return m_networkIndex.get<T>(id);
@@ -57,6 +62,16 @@ stdcxx::range<T> Network::getConnectables() {
     return m_networkIndex.getAll<Identifiable, Identifiable>() | boost::adaptors::filtered(filter) | boost::adaptors::transformed(map<T>);
 }
 
+template <typename E, typename>
+stdcxx::const_range<Identifiable> Network::getExtendedIdentifiables() const {
+    return m_networkIndex.getExtendedIdentifiables(Extension::getSlot<E>());
+}
+
+template <typename E, typename>
+stdcxx::range<Identifiable> Network::getExtendedIdentifiables() {
+    return m_networkIndex.getExtendedIdentifiables(Extension::getSlot<E>());
+}
+
 template <typename T, typename>
 unsigned long Network::getObjectCount() const {
     return m_networkIndex.getObjectCount<T>();
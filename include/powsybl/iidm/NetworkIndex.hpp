@@ -13,6 +13,7 @@
 #include <vector>
 
 #include <powsybl/iidm/Identifiable.hpp>
+#include <powsybl/stdcxx/Arena.hpp>
 #include <powsybl/stdcxx/range.hpp>
 #include <powsybl/stdcxx/reference.hpp>
 
@@ -24,6 +25,19 @@ class Network;
 class VoltageLevel;
 
 class NetworkIndex {
+public:
+    /**
+     * Destroy an identifiable created by {@link NetworkIndex::create}, whose memory is released with the index. The
+     * network itself is not destroyed: it owns the index.
+     */
+    class Deleter {
+    public:
+        void operator()(Identifiable* ptr) const;
+    };
+
+    template <typename T>
+    using Ptr = std::unique_ptr<T, Deleter>;
+
 public:
     NetworkIndex() = default;
 
@@ -41,8 +55,21 @@ public:
 
     bool addAlias(const Identifiable& obj, const std::string& alias);
 
+    /**
+     * Index the identifiable among the objects having an extension of the given slot. The objects which are not in
+     * this index, like the calculated buses, are ignored.
+     */
+    void addExtendedIdentifiable(unsigned long slot, Identifiable& identifiable);
+
     template <typename T>
-    T& checkAndAdd(std::unique_ptr<T>&& identifiable);
+    T& checkAndAdd(Ptr<T>&& identifiable);
+
+    /**
+     * Create an identifiable in the memory arena of the index. Its memory is not released when it is removed from the
+     * index, but all at once when the index is destroyed.
+     */
+    template <typename T, typename... Args>
+    Ptr<T> create(Args&&... args);
 
     template <typename T>
     const T& get(const std::string& id) const;
@@ -56,6 +83,13 @@ public:
     template <typename T, typename U = T>
     stdcxx::range<U> getAll();
 
+    /**
+     * Return the identifiables having an extension of the given slot, sorted by id
+     */
+    stdcxx::const_range<Identifiable> getExtendedIdentifiables(unsigned long slot) const;
+
+    stdcxx::range<Identifiable> getExtendedIdentifiables(unsigned long slot);
+
     template <typename T>
     unsigned long getObjectCount() const;
 
@@ -69,27 +103,34 @@ public:
 
     void removeAlias(const Identifiable& obj, const std::string& alias);
 
+    void removeExtendedIdentifiable(unsigned long slot, const Identifiable& identifiable);
+
 private:
     static void checkId(const std::string& id);
 
 private:
-    class Deleter {
-    public:
-        void operator()(Identifiable* ptr) const;
-    };
-
-    using IdentifiableById = std::map<std::string, std::unique_ptr<Identifiable, Deleter> >;
+    using IdentifiableById = std::map<std::string, Ptr<Identifiable> >;
 
     using Identifiables = std::vector<std::reference_wrapper<Identifiable> >;
 
     using IdentifiablesByType = std::unordered_map<std::type_index, Identifiables>;
 
+    // The keys and the values refer to the entries of m_objectsById, which follow the network when it is moved
+    using ExtendedIdentifiables = std::map<std::reference_wrapper<const std::string>, std::reference_wrapper<IdentifiableById::value_type>, std::less<std::string> >;
+
 private:
+    // Declared first, so that the identifiables are destroyed before their memory is released
+    stdcxx::Arena m_arena{16 * 1024, 1024 * 1024};
+
     IdentifiableById m_objectsById;
 
     mutable IdentifiablesByType m_objectsByType;
 
-    std::map<std::string, std::string> m_idByAlias;
+    // The ids refer to the keys of m_objectsById, which are not copied
+    std::map<std::string, std::reference_wrapper<const std::string> > m_idByAlias;
+
+    // Indexed by extension slot
+    std::vector<ExtendedIdentifiables> m_identifiablesByExtension;
 };
 
 template <>
@@ -18,6 +18,7 @@
 #include <powsybl/stdcxx/demangle.hpp>
 #include <powsybl/stdcxx/format.hpp>
 #include <powsybl/stdcxx/map.hpp>
+#include <powsybl/stdcxx/memory.hpp>
 #include <powsybl/stdcxx/reference.hpp>
 
 namespace powsybl {
@@ -30,7 +31,7 @@ const T& map(const Identifiable& identifiable) {
 }
 
 template <typename T>
-T& NetworkIndex::checkAndAdd(std::unique_ptr<T>&& identifiable) {
+T& NetworkIndex::checkAndAdd(Ptr<T>&& identifiable) {
     assert(identifiable);
     checkId(identifiable->getId());
 
@@ -39,18 +40,33 @@ T& NetworkIndex::checkAndAdd(std::unique_ptr<T>&& identifiable) {
         throw PowsyblException(stdcxx::format("Object '%1%' already exists (%2%)", identifiable->getId(), stdcxx::demangle(*other->second)));
     }
 
-    auto ptrIdentifiable = std::unique_ptr<Identifiable, Deleter>(identifiable.release());
-    for (const std::string& alias : ptrIdentifiable->getAliases()) {
-        addAlias(*ptrIdentifiable, alias);
-    }
+    auto ptrIdentifiable = Ptr<Identifiable>(identifiable.release());
     auto it = m_objectsById.emplace(std::make_pair(ptrIdentifiable->getId(), std::move(ptrIdentifiable)));
 
+    // The aliases refer to the id stored in the index: the object is indexed first, and removed if an alias is invalid
+    try {
+        for (const std::string& alias : it.first->second->getAliases()) {
+            addAlias(*it.first->second, alias);
+        }
+    } catch (const PowsyblException&) {
+        for (auto aliasIt = m_idByAlias.begin(); aliasIt != m_idByAlias.end();) {
+            aliasIt = stdcxx::areSame(aliasIt->second.get(), it.first->first) ? m_idByAlias.erase(aliasIt) : std::next(aliasIt);
+        }
+        m_objectsById.erase(it.first);
+        throw;
+    }
+
     std::reference_wrapper<Identifiable> refIdentifiable = *it.first->second;
     m_objectsByType[typeid(T)].emplace_back(refIdentifiable);
 
     return dynamic_cast<T&>(*it.first->second);
 }
 
+template <typename T, typename... Args>
+NetworkIndex::Ptr<T> NetworkIndex::create(Args&&... args) {
+    return Ptr<T>(m_arena.create<T>(std::forward<Args>(args)...));
+}
+
 template<typename T>
 const T& NetworkIndex::get(const std::string& id) const {
     const auto& obj = find<Identifiable>(id);
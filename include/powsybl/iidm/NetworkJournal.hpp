@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_NETWORKJOURNAL_HPP
+#define POWSYBL_IIDM_NETWORKJOURNAL_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <powsybl/iidm/NetworkListener.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Network;
+
+/**
+ * A listener recording the changes of a network in a ring buffer of fixed capacity: once the journal is full, the
+ * oldest events are overwritten.
+ *
+ * The identifiers and attribute names of the events are interned in the {@link StringPool} of the network, so an event
+ * is a small fixed-size record. A journal registers itself on construction and unregisters itself on destruction: it
+ * must not outlive its network.
+ */
+class NetworkJournal : public NetworkListener {
+public:
+    enum class EventType : unsigned char {
+        CREATION,
+        REMOVAL,
+        UPDATE
+    };
+
+    struct Event {
+    public:
+        EventType type;
+
+        std::reference_wrapper<const std::string> id;
+
+        // Empty for creations and removals
+        std::reference_wrapper<const std::string> attribute;
+
+        unsigned long variantIndex;
+
+        double oldValue;
+
+        double newValue;
+    };
+
+public: // NetworkListener
+    void afterRemoval(const std::string& id) override;
+
+    void onCreation(const Identifiable& identifiable) override;
+
+    void onUpdate(const Identifiable& identifiable, const std::string& attribute, unsigned long variantIndex, double oldValue, double newValue) override;
+
+public:
+    NetworkJournal(Network& network, unsigned long capacity);
+
+    NetworkJournal(const NetworkJournal&) = delete;
+
+    NetworkJournal(NetworkJournal&&) = delete;
+
+    ~NetworkJournal() noexcept override;
+
+    NetworkJournal& operator=(const NetworkJournal&) = delete;
+
+    NetworkJournal& operator=(NetworkJournal&&) = delete;
+
+    void clear();
+
+    unsigned long getCapacity() const;
+
+    /**
+     * Return the event at the given position, 0 being the oldest event still in the journal.
+     */
+    const Event& getEvent(unsigned long index) const;
+
+    /**
+     * Return the number of events in the journal, which is at most the capacity.
+     */
+    unsigned long getEventCount() const;
+
+    /**
+     * Return the number of events recorded since the creation of the journal or the last call to {@link #clear},
+     * including the overwritten ones.
+     */
+    unsigned long getRecordedEventCount() const;
+
+private:
+    void record(EventType type, const std::string& id, const std::string& attribute, unsigned long variantIndex, double oldValue, double newValue);
+
+private:
+    std::reference_wrapper<Network> m_network;
+
+    unsigned long m_capacity;
+
+    std::vector<Event> m_events;
+
+    unsigned long m_recordedEventCount = 0;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_NETWORKJOURNAL_HPP
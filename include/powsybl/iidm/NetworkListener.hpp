@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_NETWORKLISTENER_HPP
+#define POWSYBL_IIDM_NETWORKLISTENER_HPP
+
+#include <string>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Identifiable;
+
+/**
+ * Callback interface notified of the changes of a network. A listener is registered with {@link Network::addListener}
+ * and has to be removed before it is destroyed.
+ *
+ * The updated attributes are the topology (switch status, terminal connection) and the setpoints. Their values are
+ * given as double: booleans are converted to 0 or 1.
+ */
+class NetworkListener {
+public:
+    NetworkListener() = default;
+
+    NetworkListener(const NetworkListener&) = default;
+
+    NetworkListener(NetworkListener&&) noexcept = default;
+
+    virtual ~NetworkListener() noexcept = default;
+
+    NetworkListener& operator=(const NetworkListener&) = default;
+
+    NetworkListener& operator=(NetworkListener&&) noexcept = default;
+
+    virtual void afterRemoval(const std::string& id);
+
+    virtual void beforeRemoval(const Identifiable& identifiable);
+
+    virtual void onCreation(const Identifiable& identifiable);
+
+    virtual void onUpdate(const Identifiable& identifiable, const std::string& attribute, unsigned long variantIndex, double oldValue, double newValue);
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_NETWORKLISTENER_HPP
@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_NETWORKLISTENERLIST_HPP
+#define POWSYBL_IIDM_NETWORKLISTENERLIST_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Identifiable;
+class NetworkListener;
+
+/**
+ * The listeners of a network. Notifying an empty list does nothing: callers which have to compute the notified values
+ * should check {@link #empty} first.
+ */
+class NetworkListenerList {
+public:
+    void add(NetworkListener& listener);
+
+    bool empty() const;
+
+    void notifyAfterRemoval(const std::string& id) const;
+
+    void notifyBeforeRemoval(const Identifiable& identifiable) const;
+
+    void notifyCreation(const Identifiable& identifiable) const;
+
+    void notifyUpdate(const Identifiable& identifiable, const std::string& attribute, unsigned long variantIndex, double oldValue, double newValue) const;
+
+    void remove(NetworkListener& listener);
+
+private:
+    std::vector<std::reference_wrapper<NetworkListener>> m_listeners;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_NETWORKLISTENERLIST_HPP
@@ -19,9 +19,7 @@ namespace powsybl {
 namespace iidm {
 
 class Bus;
-class BusBreakerVoltageLevel;
 class Network;
-class NodeBreakerVoltageLevel;
 class Switch;
 
 namespace network {
@@ -49,9 +47,7 @@ public:
 private:
     void invalidateCache();
 
-    friend class iidm::BusBreakerVoltageLevel;
-
-    friend class iidm::NodeBreakerVoltageLevel;
+    friend class iidm::Network;
 
 private:
     Network& m_network;
@@ -82,9 +78,7 @@ public:
 private:
     void invalidateCache();
 
-    friend class iidm::BusBreakerVoltageLevel;
-
-    friend class iidm::NodeBreakerVoltageLevel;
+    friend class iidm::Network;
 
 private:
     Network& m_network;
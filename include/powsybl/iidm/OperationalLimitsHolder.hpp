@@ -34,6 +34,8 @@ public:  // Validable
     std::string getMessageHeader() const override;
 
 public:  // OperationalLimitsOwner
+    StringPool& getStringPool() override;
+
     stdcxx::Reference<OperationalLimits> setOperationalLimits(const LimitType& limitType, std::unique_ptr<OperationalLimits>&& operationalLimits) override;
 
 public:
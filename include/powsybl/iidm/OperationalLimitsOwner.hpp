@@ -19,6 +19,7 @@ namespace powsybl {
 namespace iidm {
 
 class OperationalLimits;
+class StringPool;
 
 class OperationalLimitsOwner : public Validable {
 public:
@@ -34,6 +35,8 @@ public:
 
     OperationalLimitsOwner& operator=(OperationalLimitsOwner&&) noexcept = default;
 
+    virtual StringPool& getStringPool() = 0;
+
     virtual stdcxx::Reference<OperationalLimits> setOperationalLimits(const LimitType& limitType, std::unique_ptr<OperationalLimits>&& operationalLimits) = 0;
 };
 
@@ -9,6 +9,7 @@
 #define POWSYBL_IIDM_REACTIVECAPABILITYCURVE_HPP
 
 #include <map>
+#include <vector>
 
 #include <powsybl/iidm/ReactiveLimits.hpp>
 #include <powsybl/stdcxx/range.hpp>
@@ -66,7 +67,8 @@ public:
     stdcxx::range<Point> getPoints();
 
 private:
-    std::map<double, Point> m_points;
+    // Sorted by increasing active power
+    std::vector<Point> m_points;
 };
 
 }  // namespace iidm
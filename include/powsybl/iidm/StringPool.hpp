@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_STRINGPOOL_HPP
+#define POWSYBL_IIDM_STRINGPOOL_HPP
+
+#include <string>
+#include <unordered_set>
+
+namespace powsybl {
+
+namespace iidm {
+
+/**
+ * A pool of immutable strings shared by the objects of a network.
+ *
+ * Interning a string returns a reference to the single copy owned by the pool. The references remain valid as long as
+ * the pool lives, even if the pool is moved, so they can be stored instead of copies of the string.
+ */
+class StringPool {
+public:
+    StringPool() = default;
+
+    StringPool(const StringPool&) = delete;
+
+    // NOLINTNEXTLINE(performance-noexcept-move-constructor): move constructor of std::unordered_set is not marked noexcept
+    StringPool(StringPool&&) = default;  // NOSONAR
+
+    ~StringPool() noexcept = default;
+
+    StringPool& operator=(const StringPool&) = delete;
+
+    StringPool& operator=(StringPool&&) = delete;
+
+    /**
+     * Return the empty string, which does not need to be interned.
+     */
+    static const std::string& getEmptyString();
+
+    const std::string& intern(const std::string& value);
+
+    unsigned long size() const;
+
+private:
+    std::unordered_set<std::string> m_strings;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_STRINGPOOL_HPP
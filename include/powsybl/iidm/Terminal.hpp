@@ -88,9 +88,9 @@ public:
 
     Terminal& setQ(double q);
 
-    virtual bool traverse(TopologyTraverser& traverser) = 0;
+    bool traverse(TopologyTraverser& traverser);
 
-    virtual bool traverse(TopologyTraverser& traverser, TerminalSet& traversedTerminals) = 0;
+    bool traverse(TopologyTraverser& traverser, TerminalSet& traversedTerminals);
 
 protected: // MultiVariantObject
     void allocateVariantArrayElement(const std::set<unsigned long>& indexes, unsigned long sourceIndex) override;
@@ -110,6 +110,19 @@ protected:
 
     Network& getNetwork();
 
+private:
+    void notifyConnectionUpdate(bool connected);
+
+    /**
+     * Traverse the topology of the voltage level of this terminal, starting from this terminal.
+     *
+     * @param nextTerminals filled with the terminals of the other sides of the traversed branches, from which the
+     * traversal continues in other voltage levels
+     *
+     * @return false if the traversal has been terminated by the traverser
+     */
+    virtual bool traverseVoltageLevel(TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) = 0;
+
 private:
     VoltageLevel& m_voltageLevel;
 
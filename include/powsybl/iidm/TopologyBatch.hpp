@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_TOPOLOGYBATCH_HPP
+#define POWSYBL_IIDM_TOPOLOGYBATCH_HPP
+
+#include <functional>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Network;
+
+/**
+ * A scope grouping topology modifications of a network: switch operations, connections, disconnections and moves of
+ * terminals. While a batch is opened, the invalidation of the calculated topology of a modified voltage level is
+ * deferred until this topology is read, and the network-wide views, the components and the topology generations are
+ * only updated when a modified voltage level is read or when the batch commits. A voltage level modified many times
+ * is thus invalidated once, and the untouched voltage levels keep their calculated topology.
+ *
+ * The batch commits when {@link #commit} is called or when it is destroyed. Batches can be nested: the invalidations
+ * are applied when the outermost batch commits.
+ */
+class TopologyBatch {
+public:
+    explicit TopologyBatch(Network& network);
+
+    TopologyBatch(const TopologyBatch&) = delete;
+
+    TopologyBatch(TopologyBatch&&) = delete;
+
+    ~TopologyBatch() noexcept;
+
+    TopologyBatch& operator=(const TopologyBatch&) = delete;
+
+    TopologyBatch& operator=(TopologyBatch&&) = delete;
+
+    void commit();
+
+    bool isCommitted() const;
+
+private:
+    std::reference_wrapper<Network> m_network;
+
+    bool m_committed = false;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_TOPOLOGYBATCH_HPP
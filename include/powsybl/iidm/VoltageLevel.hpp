@@ -169,6 +169,13 @@ public:
 
     stdcxx::range<ThreeWindingsTransformer> getThreeWindingsTransformers();
 
+    /**
+     * Return a counter incremented each time the calculated topology of this voltage level is invalidated, so that
+     * caches built from its buses can cheaply check whether they are up to date. The counter is shared by all the
+     * variants: caches spanning several variants also have to check the variant index.
+     */
+    unsigned long getTopologyGeneration() const;
+
     virtual const TopologyKind& getTopologyKind() const = 0;
 
     unsigned long getTwoWindingsTransformerCount() const;
@@ -183,7 +190,18 @@ public:
 
     stdcxx::range<VscConverterStation> getVscConverterStations();
 
-    virtual void invalidateCache() = 0;
+    /**
+     * Invalidate the calculated topology of this voltage level. Within a {@link TopologyBatch}, the invalidation is
+     * deferred until the calculated topology of this voltage level is read or the batch is committed.
+     */
+    void invalidateCache();
+
+    /**
+     * Invalidate the calculated topology of this voltage level after the open status of the given switch changed.
+     * Outside of a {@link TopologyBatch}, the voltage level may only update the buses around the switch instead of
+     * dropping its whole calculated topology.
+     */
+    void invalidateCache(const Switch& aSwitch);
 
     BatteryAdder newBattery();
 
@@ -222,14 +240,28 @@ protected:
 
     virtual stdcxx::range<Terminal> getTerminals() = 0;
 
+    /**
+     * Apply the invalidation deferred by a topology batch for the working variant, if any. Must be called before
+     * reading the calculated topology.
+     */
+    void flushCacheInvalidation();
+
+    void incrementTopologyGeneration();
+
 private: // Identifiable
     const std::string& getTypeDescription() const override;
 
 private:
+    virtual void invalidateCalculatedTopology() = 0;
+
     virtual void removeTopology() = 0;
 
+    virtual void updateCalculatedTopology(const Switch& aSwitch);
+
     void setNetworkRef(Network& network);
 
+    friend class Network;
+
     friend class NetworkIndex;
 
 private:
@@ -242,6 +274,11 @@ private:
     double m_lowVoltageLimit;
 
     double m_nominalV;
+
+    unsigned long m_topologyGeneration = 0;
+
+    // Indexes of the variants whose invalidation is deferred by a topology batch
+    std::set<unsigned long> m_pendingInvalidations;
 };
 
 }  // namespace iidm
@@ -91,6 +91,17 @@ public:
 
     virtual stdcxx::Reference<Bus> getBus(const std::string& busId) = 0;
 
+    /**
+     * Label each terminal of the voltage level with the bus of the bus view it is connected to, reading the bus
+     * cache of the working variant once.
+     *
+     * @param terminals filled with the terminals of the voltage level, in the order of their index
+     * @param buses filled with the buses of the bus view, in the order of their index
+     *
+     * @return for each terminal, the index of its bus in the buses list, or -1 if the terminal is disconnected
+     */
+    virtual std::vector<long> getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses) const = 0;
+
     virtual stdcxx::const_range<Bus> getBuses() const = 0;
 
     virtual stdcxx::range<Bus> getBuses() = 0;
@@ -119,6 +130,16 @@ public:
 
     virtual unsigned long getBusbarSectionCount() const = 0;
 
+    /**
+     * Label each node with the bus of the bus view it belongs to, in a single pass over the topology.
+     *
+     * @param buses filled with the buses of the bus view, in the order of their index
+     *
+     * @return for each node up to the maximum node index, the index of its bus in the buses list, or -1 if the node
+     * is not associated to a bus
+     */
+    virtual std::vector<long> getBusIndexByNode(std::vector<stdcxx::CReference<Bus> >& buses) const = 0;
+
     virtual stdcxx::const_range<BusbarSection> getBusbarSections() const = 0;
 
     virtual stdcxx::range<BusbarSection> getBusbarSections() = 0;
@@ -180,6 +201,12 @@ public:
     virtual void traverse(unsigned long node, const TopologyTraverser& traverser) const = 0;
 
     virtual void traverse(stdcxx::const_range<unsigned long>& nodes, const TopologyTraverser& traverser) const = 0;
+
+    /**
+     * Traverse the topology from the given node without crossing the open switches, which are not given to the
+     * traverser. The status of the switches is read from bitsets of the current variant, maintained by the voltage level.
+     */
+    virtual void traverseClosedSwitches(unsigned long node, const TopologyTraverser& traverser) const = 0;
 };
 
 }  // namespace voltage_level
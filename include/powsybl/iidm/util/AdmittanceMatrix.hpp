@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_UTIL_ADMITTANCEMATRIX_HPP
+#define POWSYBL_IIDM_UTIL_ADMITTANCEMATRIX_HPP
+
+#include <array>
+#include <complex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <powsybl/iidm/util/LinkData.hpp>
+#include <powsybl/stdcxx/reference.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Network;
+class Terminal;
+class TwoWindingsTransformer;
+
+namespace three_windings_transformer {
+
+class Leg;
+
+}  // namespace three_windings_transformer
+
+/**
+ * Sparse complex bus admittance matrix (Ybus) of a network, stored in CSR format.
+ *
+ * Rows and columns are numbered following the iteration order of the buses of the bus view. Each three windings
+ * transformer adds an internal star bus, numbered after the buses of the bus view. Lines, tie lines, two windings
+ * transformers and three windings transformer legs contribute to the matrix if both of their ends are connected.
+ *
+ * The structure of the matrix is computed once from the current topology: a topology change requires to build a new
+ * matrix, whereas a change of the tap positions can be taken into account with {@link #updateTapPositions}.
+ */
+class AdmittanceMatrix {
+public:
+    explicit AdmittanceMatrix(const Network& network);
+
+    std::complex<double> get(unsigned long row, unsigned long column) const;
+
+    unsigned long getBusCount() const;
+
+    unsigned long getBusIndex(const std::string& busId) const;
+
+    const std::vector<unsigned long>& getColumnIndices() const;
+
+    const std::vector<unsigned long>& getRowOffsets() const;
+
+    unsigned long getSize() const;
+
+    const std::vector<std::complex<double>>& getValues() const;
+
+    /**
+     * Recompute the admittances of the transformers from their current tap positions, and update the values of the
+     * matrix accordingly. The structure of the matrix is left unchanged.
+     */
+    void updateTapPositions();
+
+private:
+    using Positions = std::array<unsigned long, 4>;
+
+private:
+    void addBranch(long bus1, long bus2);
+
+    void buildStructure();
+
+    long getBusIndex(const Terminal& terminal) const;
+
+    void scatter();
+
+    void setLegParameters(unsigned long index, const three_windings_transformer::Leg& leg, double ratedU0);
+
+    void setTwoWindingsTransformerParameters(unsigned long index, const TwoWindingsTransformer& twt);
+
+private:
+    std::unordered_map<std::string, unsigned long> m_busIndexes;
+
+    unsigned long m_size = 0;
+
+    LinkData::BranchAdmittanceParameters m_parameters;
+
+    std::vector<LinkData::BranchAdmittanceMatrix> m_admittances;
+
+    std::vector<std::array<long, 2>> m_branchBuses;
+
+    std::vector<Positions> m_branchPositions;
+
+    unsigned long m_firstTransformer = 0;
+
+    std::vector<std::reference_wrapper<const TwoWindingsTransformer>> m_twoWindingsTransformers;
+
+    std::vector<std::pair<std::reference_wrapper<const three_windings_transformer::Leg>, double>> m_legs;
+
+    std::vector<unsigned long> m_rowOffsets;
+
+    std::vector<unsigned long> m_columnIndices;
+
+    std::vector<std::complex<double>> m_values;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_UTIL_ADMITTANCEMATRIX_HPP
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_UTIL_LIMITVIOLATIONSCANNER_HPP
+#define POWSYBL_IIDM_UTIL_LIMITVIOLATIONSCANNER_HPP
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <powsybl/iidm/Branch.hpp>
+#include <powsybl/iidm/LimitType.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Network;
+
+/**
+ * Network-wide check of the loading limits of the branches.
+ *
+ * The permanent and temporary limits of all the branches are flattened once, at construction, into contiguous arrays.
+ * A scan then gathers the flows of the terminals for a variant, computes the values to compare in a single pass and
+ * checks every branch side, optionally in parallel. The results are consistent with
+ * {@link Branch::checkPermanentLimit} and {@link Branch::checkTemporaryLimits}.
+ *
+ * The limits are read only once: a scanner has to be rebuilt if branches or limits are added, removed or modified.
+ */
+class LimitViolationScanner {
+public:
+    /**
+     * A compact description of a limit violation: the branch and the limit are given as indexes, which can be
+     * resolved with the accessors of the scanner.
+     */
+    struct Violation {
+    public:
+        unsigned long branch;
+
+        Branch::Side side;
+
+        unsigned long limit;
+
+        double value;
+    };
+
+public:
+    explicit LimitViolationScanner(Network& network, const LimitType& type = LimitType::CURRENT);
+
+    /**
+     * Return the acceptable duration of the violation: the acceptable duration of the first temporary limit which is
+     * not exceeded, 0 if all the temporary limits are exceeded, or the maximal value if the branch side has no temporary
+     * limits.
+     */
+    unsigned long getAcceptableDuration(const Violation& violation) const;
+
+    const Branch& getBranch(const Violation& violation) const;
+
+    unsigned long getBranchCount() const;
+
+    /**
+     * Return the value of the exceeded limit, without limit reduction.
+     */
+    double getLimit(const Violation& violation) const;
+
+    /**
+     * Return the name of the exceeded limit, or an empty string for a permanent limit.
+     */
+    const std::string& getLimitName(const Violation& violation) const;
+
+    const LimitType& getLimitType() const;
+
+    bool isPermanentLimit(const Violation& violation) const;
+
+    /**
+     * Check the limits of all the branches for the working variant.
+     *
+     * @param limitReduction The reduction factor applied to the limits
+     * @param threadCount The number of threads sharing the branches
+     *
+     * @return The violations, ordered by branch and side
+     */
+    std::vector<Violation> scan(double limitReduction = 1.0, unsigned long threadCount = 1) const;
+
+    /**
+     * Check the limits of all the branches for each of the given variants. The working variant is restored after
+     * the flows have been read.
+     *
+     * @param variantIds The variants to check
+     * @param limitReduction The reduction factor applied to the limits
+     * @param threadCount The number of threads sharing the variants
+     *
+     * @return The violations of each variant, in the order of the given variants
+     */
+    std::vector<std::vector<Violation>> scan(const std::vector<std::string>& variantIds, double limitReduction = 1.0, unsigned long threadCount = 1) const;
+
+private:
+    struct Flows {
+    public:
+        std::vector<double> p;
+
+        std::vector<double> q;
+
+        std::vector<double> v;
+    };
+
+private:
+    void check(const Flows& flows, double limitReduction, unsigned long begin, unsigned long end, std::vector<Violation>& violations) const;
+
+    Flows readFlows() const;
+
+private:
+    std::reference_wrapper<Network> m_network;
+
+    LimitType m_type;
+
+    std::vector<std::reference_wrapper<const Branch>> m_branches;
+
+    // For each branch side (2 * branch + side), the range [m_offsets[i], m_offsets[i + 1]) of its limits, ordered by
+    // increasing value, the first one being the permanent limit. Branch sides without limits have an empty range.
+    std::vector<unsigned long> m_offsets;
+
+    std::vector<double> m_limits;
+
+    std::vector<unsigned long> m_acceptableDurations;
+
+    std::vector<std::reference_wrapper<const std::string>> m_limitNames;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_UTIL_LIMITVIOLATIONSCANNER_HPP
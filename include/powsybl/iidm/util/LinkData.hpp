@@ -9,6 +9,7 @@
 #define POWSYBL_IIDM_UTIL_LINKDATA_HPP
 
 #include <complex>
+#include <vector>
 
 namespace powsybl {
 
@@ -34,9 +35,53 @@ public:
     std::complex<double> y22;
 };
 
+/**
+ * Branch parameters stored as structure of arrays, so that the admittances of many branches can be computed in a
+ * single vectorizable loop.
+ */
+struct BranchAdmittanceParameters {
+public:
+    void resize(unsigned long size);
+
+    unsigned long size() const;
+
+public:
+    std::vector<double> r;
+
+    std::vector<double> x;
+
+    std::vector<double> ratio1;
+
+    std::vector<double> angle1;
+
+    std::vector<double> ratio2;
+
+    std::vector<double> angle2;
+
+    std::vector<double> g1;
+
+    std::vector<double> b1;
+
+    std::vector<double> g2;
+
+    std::vector<double> b2;
+};
+
 BranchAdmittanceMatrix calculateBranchAdmittance(double r, double x, double ratio1, double angle1,
                                                  double ratio2, double angle2, const std::complex<double>& ysh1, const std::complex<double>& ysh2);
 
+/**
+ * Compute the admittance matrices of the branches in the range [begin, end) of the given parameters. The result is
+ * the same as calling calculateBranchAdmittance for each branch.
+ *
+ * @param parameters The parameters of the branches
+ * @param begin The index of the first branch to compute
+ * @param end The index past the last branch to compute
+ * @param admittances The computed matrices, which must be at least parameters.size() long
+ */
+void calculateBranchAdmittances(const BranchAdmittanceParameters& parameters, unsigned long begin, unsigned long end,
+                                std::vector<BranchAdmittanceMatrix>& admittances);
+
 }  // namespace LinkData
 
 }  // namespace iidm
@@ -38,6 +38,7 @@ stdcxx::CReference<Terminal> getEquivalentTerminal(const VoltageLevel& voltageLe
 /**
  * Return the list of nodes (N/B topology) for each bus of a the Bus view
  * If a node is not associated to a bus, it is not included in any list.
+ * The nodes are labelled in a single pass, see {@link voltage_level::NodeBreakerView::getBusIndexByNode}.
  *
  * @param voltageLevel The voltage level to traverse
  *
@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_UTIL_REACTIVELIMITSEVALUATOR_HPP
+#define POWSYBL_IIDM_UTIL_REACTIVELIMITSEVALUATOR_HPP
+
+#include <functional>
+#include <vector>
+
+namespace powsybl {
+
+namespace iidm {
+
+class Generator;
+class Network;
+
+/**
+ * Network-wide evaluation of the reactive limits of the generators.
+ *
+ * The reactive limits of all the generators are flattened once, at construction, into contiguous arrays of points.
+ * A {@link MinMaxReactiveLimits} is stored as a curve of two points with the same reactive limits, so that every
+ * generator is evaluated with the same interpolation. The results are consistent with {@link ReactiveLimits::getMinQ}
+ * and {@link ReactiveLimits::getMaxQ}.
+ *
+ * The limits are read only once: an evaluator has to be rebuilt if generators are added or removed, or if their
+ * reactive limits are modified.
+ */
+class ReactiveLimitsEvaluator {
+public:
+    explicit ReactiveLimitsEvaluator(const Network& network);
+
+    const Generator& getGenerator(unsigned long index) const;
+
+    unsigned long getGeneratorCount() const;
+
+    /**
+     * Compute the reactive limits of all the generators at their target active power.
+     *
+     * @param minQ The buffer receiving the minimum reactive power of each generator, resized if needed
+     * @param maxQ The buffer receiving the maximum reactive power of each generator, resized if needed
+     */
+    void getReactiveLimits(std::vector<double>& minQ, std::vector<double>& maxQ) const;
+
+    /**
+     * Compute the reactive limits of all the generators at the given active power.
+     *
+     * @param p The active power of each generator, in the order of the generators of the evaluator
+     * @param minQ The buffer receiving the minimum reactive power of each generator, resized if needed
+     * @param maxQ The buffer receiving the maximum reactive power of each generator, resized if needed
+     */
+    void getReactiveLimits(const std::vector<double>& p, std::vector<double>& minQ, std::vector<double>& maxQ) const;
+
+private:
+    std::vector<std::reference_wrapper<const Generator>> m_generators;
+
+    // For each generator, the range [m_offsets[i], m_offsets[i + 1]) of its points, ordered by increasing active power.
+    // Each generator has at least 2 points.
+    std::vector<unsigned long> m_offsets;
+
+    std::vector<double> m_p;
+
+    std::vector<double> m_minQ;
+
+    std::vector<double> m_maxQ;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_UTIL_REACTIVELIMITSEVALUATOR_HPP
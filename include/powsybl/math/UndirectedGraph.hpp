@@ -15,6 +15,7 @@
 
 #include <powsybl/math/Traverser.hpp>
 #include <powsybl/math/UndirectedGraphRanges.hpp>
+#include <powsybl/stdcxx/Arena.hpp>
 #include <powsybl/stdcxx/range.hpp>
 #include <powsybl/stdcxx/reference.hpp>
 
@@ -40,7 +41,11 @@ public:
 public:
     UndirectedGraph() = default;
 
-    ~UndirectedGraph() noexcept = default;
+    UndirectedGraph(const UndirectedGraph&) = delete;
+
+    ~UndirectedGraph() noexcept;
+
+    UndirectedGraph& operator=(const UndirectedGraph&) = delete;
 
     unsigned long addEdge(unsigned long v1, unsigned long v2, const stdcxx::Reference<E>& object);
 
@@ -112,6 +117,12 @@ private:
 
     void cleanVertices(unsigned long v);
 
+    template <typename T, typename... Args>
+    T* create(std::vector<T*>& freeObjects, Args&&... args);
+
+    template <typename T>
+    void destroy(T*& object, std::vector<T*>& freeObjects);
+
     void findAllPaths(unsigned long v, const VertexVisitor& pathComplete, const EdgeVisitor& pathCanceled,
                       const Path& path, std::vector<bool>& encountered, std::vector<Path>& paths) const;
 
@@ -123,9 +134,16 @@ private:
     void invalidateAdjacencyList();
 
 private:
-    std::vector<std::unique_ptr<Vertex> > m_vertices;
+    // The vertices and the edges are allocated in this arena, and their memory is reused once they are removed
+    stdcxx::Arena m_arena;
+
+    std::vector<Vertex*> m_vertices;
+
+    std::vector<Edge*> m_edges;
+
+    std::vector<Vertex*> m_freeVertices;
 
-    std::vector<std::unique_ptr<Edge> > m_edges;
+    std::vector<Edge*> m_freeEdges;
 
     std::set<unsigned long> m_availableVertices;
 
@@ -18,27 +18,40 @@
 #include <boost/range/counting_range.hpp>
 
 #include <powsybl/stdcxx/format.hpp>
-#include <powsybl/stdcxx/make_unique.hpp>
 
 namespace powsybl {
 
 namespace math {
 
+template <typename V, typename E>
+UndirectedGraph<V, E>::~UndirectedGraph() noexcept {
+    for (Edge* edge : m_edges) {
+        if (edge != nullptr) {
+            edge->~Edge();
+        }
+    }
+    for (Vertex* vertex : m_vertices) {
+        if (vertex != nullptr) {
+            vertex->~Vertex();
+        }
+    }
+}
+
 template <typename V, typename E>
 unsigned long UndirectedGraph<V, E>::addEdge(unsigned long v1, unsigned long v2, const stdcxx::Reference<E>& object) {
     checkVertex(v1);
     checkVertex(v2);
 
     unsigned long e;
-    std::unique_ptr<Edge> edge = stdcxx::make_unique<Edge>(v1, v2, object);
+    Edge* edge = create<Edge>(m_freeEdges, v1, v2, object);
     if (m_removedEdges.empty()) {
         e = m_edges.size();
-        m_edges.emplace_back(std::move(edge));
+        m_edges.push_back(edge);
     } else {
         e = *m_removedEdges.begin();
         m_removedEdges.erase(m_removedEdges.begin());
 
-        m_edges[e] = std::move(edge);
+        m_edges[e] = edge;
     }
 
     invalidateAdjacencyList();
@@ -50,15 +63,15 @@ template <typename V, typename E>
 unsigned long UndirectedGraph<V, E>::addVertex() {
     unsigned long v;
 
-    std::unique_ptr<Vertex> vertex = stdcxx::make_unique<Vertex>();
+    Vertex* vertex = create<Vertex>(m_freeVertices);
     if (m_availableVertices.empty()) {
         v = m_vertices.size();
-        m_vertices.emplace_back(std::move(vertex));
+        m_vertices.push_back(vertex);
     } else {
         v = *m_availableVertices.begin();
         m_availableVertices.erase(m_availableVertices.begin());
 
-        m_vertices[v] = std::move(vertex);
+        m_vertices[v] = vertex;
     }
 
     invalidateAdjacencyList();
@@ -71,15 +84,15 @@ void UndirectedGraph<V, E>::addVertexIfNotPresent(unsigned long v) {
     if (v < m_vertices.size()) {
         const auto& it = m_availableVertices.find(v);
         if (it != m_availableVertices.end()) {
-            m_vertices[v] = stdcxx::make_unique<Vertex>();
+            m_vertices[v] = create<Vertex>(m_freeVertices);
             m_availableVertices.erase(it);
         }
     } else {
         for (unsigned int i = m_vertices.size(); i < v; ++i) {
             m_availableVertices.insert(i);
         }
-        m_vertices.resize(v + 1);
-        m_vertices[v] = stdcxx::make_unique<Vertex>();
+        m_vertices.resize(v + 1, nullptr);
+        m_vertices[v] = create<Vertex>(m_freeVertices);
     }
     invalidateAdjacencyList();
 }
@@ -110,6 +123,26 @@ void UndirectedGraph<V, E>::cleanVertices(unsigned long v) {
     }
 }
 
+template <typename V, typename E>
+template <typename T, typename... Args>
+T* UndirectedGraph<V, E>::create(std::vector<T*>& freeObjects, Args&&... args) {
+    if (freeObjects.empty()) {
+        return m_arena.create<T>(std::forward<Args>(args)...);
+    }
+
+    T* object = new (freeObjects.back()) T(std::forward<Args>(args)...);
+    freeObjects.pop_back();
+    return object;
+}
+
+template <typename V, typename E>
+template <typename T>
+void UndirectedGraph<V, E>::destroy(T*& object, std::vector<T*>& freeObjects) {
+    object->~T();
+    freeObjects.push_back(object);
+    object = nullptr;
+}
+
 template <typename V, typename E>
 std::vector<typename UndirectedGraph<V, E>::Path> UndirectedGraph<V, E>::findAllPaths(unsigned long v, const VertexVisitor& pathComplete, const EdgeVisitor& pathCanceled) const {
     std::vector<Path> paths;
@@ -136,7 +169,7 @@ void UndirectedGraph<V, E>::findAllPaths(unsigned long v, const VertexVisitor& p
     const std::vector<unsigned long>& adjacentEdges = adjacencyList[v];
 
     for (const auto& e : adjacentEdges) {
-        const std::unique_ptr<Edge>& edge = m_edges[e];
+        const Edge* edge = m_edges[e];
         if (pathCanceled(edge->getObject())) {
             continue;
         }
@@ -167,7 +200,7 @@ bool UndirectedGraph<V, E>::findAllPaths(unsigned long e, unsigned long v, const
         return false;
     }
 
-    const std::unique_ptr<Vertex>& vertex = m_vertices[v];
+    const Vertex* vertex = m_vertices[v];
     path.push_back(e);
     if (pathComplete(vertex->getObject())) {
         paths.emplace_back(std::move(path));
@@ -193,8 +226,8 @@ const std::vector<std::vector<unsigned long> >& UndirectedGraph<V, E>::getAdjace
         }
 
         for (unsigned long e = 0; e < m_edges.size(); ++e) {
-            const std::unique_ptr<Edge>& edge = m_edges[e];
-            if (edge) {
+            const Edge* edge = m_edges[e];
+            if (edge != nullptr) {
                 m_adjacencyList[edge->getVertex1()].push_back(e);
                 m_adjacencyList[edge->getVertex2()].push_back(e);
             }
@@ -218,8 +251,8 @@ const stdcxx::Reference<E>& UndirectedGraph<V, E>::getEdgeObject(unsigned long e
 
 template <typename V, typename E>
 typename UndirectedGraph<V, E>::template const_range<E> UndirectedGraph<V, E>::getEdgeObjects() const {
-    const auto& filter = [](const std::unique_ptr<Edge>& edge) {
-        return static_cast<bool>(edge);
+    const auto& filter = [](const Edge* edge) {
+        return edge != nullptr;
     };
 
     return m_edges | boost::adaptors::filtered(filter) | boost::adaptors::indirected | boost::adaptors::transformed(Edge::map);
@@ -227,8 +260,8 @@ typename UndirectedGraph<V, E>::template const_range<E> UndirectedGraph<V, E>::g
 
 template <typename V, typename E>
 typename UndirectedGraph<V, E>::template range<E> UndirectedGraph<V, E>::getEdgeObjects() {
-    const auto& filter = [](const std::unique_ptr<Edge>& edge) {
-        return static_cast<bool>(edge);
+    const auto& filter = [](const Edge* edge) {
+        return edge != nullptr;
     };
 
     return m_edges | boost::adaptors::filtered(filter) | boost::adaptors::indirected | boost::adaptors::transformed(Edge::map);
@@ -243,7 +276,7 @@ typename UndirectedGraph<V, E>::template const_range<E> UndirectedGraph<V, E>::g
     const std::vector<unsigned long>& adjacentEdges = adjacencyList[v1];
 
     const auto& edgeMapper = [this](const unsigned long& e) {
-        return m_edges[e].get();
+        return m_edges[e];
     };
     const auto& edgeFilter = [v1, v2](const Edge& edge) {
         return ((edge->getVertex1() == v1 && edge->getVertex2() == v2) || (edge->getVertex1() == v2 && edge->getVertex2() == v1));
@@ -258,7 +291,7 @@ typename UndirectedGraph<V, E>::template const_range<E> UndirectedGraph<V, E>::g
 template <typename V, typename E>
 typename UndirectedGraph<V, E>::template const_range<unsigned long> UndirectedGraph<V, E>::getEdges() const {
     const auto& filter = [this](const unsigned long e) {
-        return static_cast<bool>(m_edges[e]);
+        return m_edges[e] != nullptr;
     };
 
     return boost::counting_range(0UL, static_cast<unsigned long>(m_edges.size())) | boost::adaptors::filtered(filter);
@@ -272,13 +305,13 @@ unsigned long UndirectedGraph<V, E>::getMaxVertex() const {
 template <typename V, typename E>
 unsigned long UndirectedGraph<V, E>::getVertex1(unsigned long e) const {
     checkEdge(e);
-    return m_edges.at(e).get()->getVertex1();
+    return m_edges.at(e)->getVertex1();
 }
 
 template <typename V, typename E>
 unsigned long UndirectedGraph<V, E>::getVertex2(unsigned long e) const {
     checkEdge(e);
-    return m_edges.at(e).get()->getVertex2();
+    return m_edges.at(e)->getVertex2();
 }
 
 template <typename V, typename E>
@@ -300,8 +333,8 @@ const stdcxx::Reference<V>& UndirectedGraph<V, E>::getVertexObject(unsigned long
 
 template <typename V, typename E>
 typename UndirectedGraph<V, E>::template const_range<V> UndirectedGraph<V, E>::getVertexObjects() const {
-    const auto& filter = [](const std::unique_ptr<Vertex>& vertex) {
-        return static_cast<bool>(vertex);
+    const auto& filter = [](const Vertex* vertex) {
+        return vertex != nullptr;
     };
 
     return m_vertices | boost::adaptors::filtered(filter) | boost::adaptors::indirected | boost::adaptors::transformed(Vertex::map);
@@ -309,8 +342,8 @@ typename UndirectedGraph<V, E>::template const_range<V> UndirectedGraph<V, E>::g
 
 template <typename V, typename E>
 typename UndirectedGraph<V, E>::template range<V> UndirectedGraph<V, E>::getVertexObjects() {
-    const auto& filter = [](const std::unique_ptr<Vertex>& vertex) {
-        return static_cast<bool>(vertex);
+    const auto& filter = [](const Vertex* vertex) {
+        return vertex != nullptr;
     };
 
     return m_vertices | boost::adaptors::filtered(filter) | boost::adaptors::indirected | boost::adaptors::transformed(Vertex::map);
@@ -319,7 +352,7 @@ typename UndirectedGraph<V, E>::template range<V> UndirectedGraph<V, E>::getVert
 template <typename V, typename E>
 typename UndirectedGraph<V, E>::template const_range<unsigned long> UndirectedGraph<V, E>::getVertices() const {
     const auto& filter = [this](const unsigned long v) {
-        return static_cast<bool>(m_vertices[v]);
+        return m_vertices[v] != nullptr;
     };
 
     return boost::counting_range(0UL, static_cast<unsigned long>(m_vertices.size())) | boost::adaptors::filtered(filter);
@@ -334,6 +367,11 @@ void UndirectedGraph<V, E>::invalidateAdjacencyList() {
 
 template <typename V, typename E>
 void UndirectedGraph<V, E>::removeAllEdges() {
+    for (Edge*& edge : m_edges) {
+        if (edge != nullptr) {
+            destroy(edge, m_freeEdges);
+        }
+    }
     m_edges.clear();
     m_removedEdges.clear();
 
@@ -346,6 +384,11 @@ void UndirectedGraph<V, E>::removeAllVertices() {
         throw PowsyblException("Cannot remove all vertices because there is still some edges in the graph");
     }
 
+    for (Vertex*& vertex : m_vertices) {
+        if (vertex != nullptr) {
+            destroy(vertex, m_freeVertices);
+        }
+    }
     m_vertices.clear();
     m_availableVertices.clear();
 
@@ -357,10 +400,10 @@ stdcxx::Reference<E> UndirectedGraph<V, E>::removeEdge(unsigned long e) {
     checkEdge(e);
 
     stdcxx::Reference<E> object = m_edges[e]->getObject();
+    destroy(m_edges[e], m_freeEdges);
     if (e == m_edges.size() - 1) {
         m_edges.pop_back();
     } else {
-        m_edges[e].reset();
         m_removedEdges.insert(e);
     }
 
@@ -390,18 +433,18 @@ stdcxx::Reference<V> UndirectedGraph<V, E>::removeVertex(unsigned long v) {
     checkVertex(v);
 
     for (const auto& edge : m_edges) {
-        if (edge && (edge->getVertex1() == v || edge->getVertex2() == v)) {
+        if (edge != nullptr && (edge->getVertex1() == v || edge->getVertex2() == v)) {
             throw PowsyblException(stdcxx::format("An edge is connected to the vertex %1%", v));
 
         }
     }
 
     stdcxx::Reference<V> object = m_vertices[v]->getObject();
+    destroy(m_vertices[v], m_freeVertices);
     if (v == m_vertices.size() - 1) {
         m_vertices.pop_back();
         cleanVertices(v - 1);
     } else {
-        m_vertices[v].reset();
         m_availableVertices.insert(v);
     }
 
@@ -448,7 +491,7 @@ bool UndirectedGraph<V, E>::traverse(unsigned long v, const Traverser& traverser
     encountered[v] = true;
     bool keepGoing = true;
     for (unsigned long e : adjacentEdges) {
-        const std::unique_ptr<Edge>& edge = m_edges[e];
+        const Edge* edge = m_edges[e];
         unsigned long v1 = edge->getVertex1();
         unsigned long v2 = edge->getVertex2();
         if (!encountered[v1]) {
@@ -478,7 +521,7 @@ bool UndirectedGraph<V, E>::traverse(unsigned long v, const Traverser& traverser
 
 template <typename V, typename E>
 bool UndirectedGraph<V, E>::vertexExists(unsigned long v) const {
-    return v < m_vertices.size() && m_vertices[v];
+    return v < m_vertices.size() && m_vertices[v] != nullptr;
 }
 
 template <typename V, typename E>
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_STDCXX_ARENA_HPP
+#define POWSYBL_STDCXX_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace stdcxx {
+
+/**
+ * A monotonic allocator: the memory is taken from blocks of increasing size and only released when the arena is
+ * destroyed, all at once.
+ *
+ * The arena does not call the destructors of the objects it created: their owner has to destroy them before the arena.
+ * The objects never move, even if the arena is moved.
+ */
+class Arena {
+public:
+    explicit Arena(std::size_t initialBlockSize = 1024, std::size_t maxBlockSize = 64 * 1024);
+
+    Arena(const Arena&) = delete;
+
+    Arena(Arena&& arena) noexcept;
+
+    ~Arena() noexcept = default;
+
+    Arena& operator=(const Arena&) = delete;
+
+    Arena& operator=(Arena&& arena) noexcept;
+
+    /**
+     * Return a memory area of the given size, aligned at most on alignof(std::max_align_t).
+     */
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    std::size_t getBlockCount() const;
+
+    /**
+     * Return the number of bytes given by this arena, including the padding.
+     */
+    std::size_t getUsedSize() const;
+
+private:
+    std::size_t m_nextBlockSize;
+
+    std::size_t m_maxBlockSize;
+
+    std::vector<std::unique_ptr<char[]> > m_blocks;
+
+    char* m_current = nullptr;
+
+    std::size_t m_remaining = 0;
+
+    std::size_t m_usedSize = 0;
+};
+
+}  // namespace stdcxx
+
+#endif  // POWSYBL_STDCXX_ARENA_HPP
@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_STDCXX_PARALLEL_HPP
+#define POWSYBL_STDCXX_PARALLEL_HPP
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace stdcxx {
+
+/**
+ * Split [0, count) into at most threadCount contiguous chunks, and call function(chunk, begin, end) for each of them on
+ * its own thread. The function is called on the current thread if a single chunk is needed.
+ *
+ * @return the number of chunks
+ */
+template <typename Function>
+unsigned long parallelFor(unsigned long count, unsigned long threadCount, const Function& function) {
+    const unsigned long chunkCount = std::max(1UL, std::min(threadCount, count));
+    if (chunkCount == 1) {
+        function(0, 0, count);
+        return chunkCount;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(chunkCount);
+    for (unsigned long chunk = 0; chunk < chunkCount; ++chunk) {
+        threads.emplace_back(function, chunk, count * chunk / chunkCount, count * (chunk + 1) / chunkCount);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return chunkCount;
+}
+
+}  // namespace stdcxx
+
+#endif  // POWSYBL_STDCXX_PARALLEL_HPP
@@ -37,33 +37,33 @@ AbstractComponentsManager::AbstractComponentsManager(Network& network, AbstractC
     }
 }
 
-void AbstractComponentsManager::addToAdjacencyList(const stdcxx::CReference<Bus>& bus1, const stdcxx::CReference<Bus>& bus2, const std::map<std::string, unsigned long>& id2num, std::vector<std::vector<unsigned long>>& adjacencyList) const {
+void AbstractComponentsManager::addToAdjacencyList(const stdcxx::CReference<Bus>& bus1, const stdcxx::CReference<Bus>& bus2, const std::unordered_map<const Bus*, unsigned long>& bus2num, std::vector<std::vector<unsigned long>>& adjacencyList) const {
     if (bus1 && bus2) {
-        unsigned long busNum1 = id2num.find(bus1.get().getId())->second;
-        unsigned long busNum2 = id2num.find(bus2.get().getId())->second;
+        unsigned long busNum1 = bus2num.find(&bus1.get())->second;
+        unsigned long busNum2 = bus2num.find(&bus2.get())->second;
         adjacencyList[busNum1].emplace_back(busNum2);
         adjacencyList[busNum2].emplace_back(busNum1);
     }
 }
 
-void AbstractComponentsManager::fillAdjacencyList(const std::map<std::string, unsigned long>& id2num, std::vector<std::vector<unsigned long>>& adjacencyList) const {
+void AbstractComponentsManager::fillAdjacencyList(const std::unordered_map<const Bus*, unsigned long>& bus2num, std::vector<std::vector<unsigned long>>& adjacencyList) const {
     for (const Line& line : getNetwork().getLines()) {
         const auto& bus1 = line.getTerminal1().getBusView().getBus();
         const auto& bus2 = line.getTerminal2().getBusView().getBus();
-        addToAdjacencyList(bus1, bus2, id2num, adjacencyList);
+        addToAdjacencyList(bus1, bus2, bus2num, adjacencyList);
     }
     for (const TwoWindingsTransformer& twt : getNetwork().getTwoWindingsTransformers()) {
         const auto& bus1 = twt.getTerminal1().getBusView().getBus();
         const auto& bus2 = twt.getTerminal2().getBusView().getBus();
-        addToAdjacencyList(bus1, bus2, id2num, adjacencyList);
+        addToAdjacencyList(bus1, bus2, bus2num, adjacencyList);
     }
     for (const ThreeWindingsTransformer& twt : getNetwork().getThreeWindingsTransformers()) {
         const auto& busA = twt.getLeg1().getTerminal().getBusView().getBus();
         const auto& busB = twt.getLeg2().getTerminal().getBusView().getBus();
         const auto& busC = twt.getLeg3().getTerminal().getBusView().getBus();
-        addToAdjacencyList(busA, busB, id2num, adjacencyList);
-        addToAdjacencyList(busA, busC, id2num, adjacencyList);
-        addToAdjacencyList(busB, busC, id2num, adjacencyList);
+        addToAdjacencyList(busA, busB, bus2num, adjacencyList);
+        addToAdjacencyList(busA, busC, bus2num, adjacencyList);
+        addToAdjacencyList(busB, busC, bus2num, adjacencyList);
     }
 }
 
@@ -113,18 +113,18 @@ void AbstractComponentsManager::update() {
     }
 
     unsigned long num = 0UL;
-    std::map<std::string, unsigned long> id2num;
+    std::unordered_map<const Bus*, unsigned long> bus2num;
     std::vector<std::reference_wrapper<Bus>> num2bus;
     for (Bus& bus : getNetwork().getBusView().getBuses()) {
         num2bus.emplace_back(std::ref(bus));
-        id2num[bus.getId()] = num;
+        bus2num[&bus] = num;
         num++;
     }
     std::vector<std::vector<unsigned long>> adjacencyList(num);
     for (auto& v : adjacencyList) {
         v.reserve(3);
     }
-    fillAdjacencyList(id2num, adjacencyList);
+    fillAdjacencyList(bus2num, adjacencyList);
 
     const auto& result = math::GraphUtil::computeConnectedComponents(adjacencyList);
     const auto& componentNumbers = result.getComponentNumber();
@@ -29,12 +29,14 @@ Battery& BatteryAdder::add() {
     checkMaxP(*this, m_maxP);
     checkActivePowerLimits(*this, m_minP, m_maxP);
 
-    std::unique_ptr<Battery> ptrBattery = stdcxx::make_unique<Battery>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(), m_p0, m_q0, m_minP, m_maxP);
+    NetworkIndex::Ptr<Battery> ptrBattery = getNetwork().createIdentifiable<Battery>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(), m_p0, m_q0, m_minP, m_maxP);
     auto& battery = getNetwork().checkAndAdd<Battery>(std::move(ptrBattery));
 
     Terminal& terminal = battery.addTerminal(checkAndGetTerminal());
     getVoltageLevel().attach(terminal, false);
 
+    getNetwork().getListeners().notifyCreation(battery);
+
     return battery;
 }
 
@@ -21,7 +21,7 @@ BusAdder::BusAdder(VoltageLevel& voltageLevel) :
 Bus& BusAdder::add() {
     auto& voltageLevel = dynamic_cast<BusBreakerVoltageLevel&>(m_voltageLevel);
 
-    std::unique_ptr<ConfiguredBus> ptrBus = stdcxx::make_unique<ConfiguredBus>(checkAndGetUniqueId(), getName(), isFictitious(), voltageLevel);
+    NetworkIndex::Ptr<ConfiguredBus> ptrBus = getNetwork().createIdentifiable<ConfiguredBus>(checkAndGetUniqueId(), getName(), isFictitious(), voltageLevel);
     return voltageLevel.addBus(std::move(ptrBus));
 }
 
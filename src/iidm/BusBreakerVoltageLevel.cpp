@@ -15,6 +15,7 @@
 #include <powsybl/iidm/Switch.hpp>
 #include <powsybl/iidm/ValidationUtils.hpp>
 #include <powsybl/stdcxx/flattened.hpp>
+#include <powsybl/stdcxx/memory.hpp>
 #include <powsybl/stdcxx/reference.hpp>
 
 #include "BusTerminal.hpp"
@@ -31,17 +32,19 @@ BusBreakerVoltageLevel::BusBreakerVoltageLevel(const std::string& id, const std:
     m_busView(*this) {
 }
 
-Bus& BusBreakerVoltageLevel::addBus(std::unique_ptr<ConfiguredBus>&& ptrBus) {
+Bus& BusBreakerVoltageLevel::addBus(NetworkIndex::Ptr<ConfiguredBus>&& ptrBus) {
     ConfiguredBus& bus = getNetwork().checkAndAdd(std::move(ptrBus));
 
     unsigned long node = m_graph.addVertex();
     m_graph.setVertexObject(node, stdcxx::ref(bus));
     m_buses.insert(std::make_pair(bus.getId(), node));
 
+    getNetwork().getListeners().notifyCreation(bus);
+
     return bus;
 }
 
-Switch& BusBreakerVoltageLevel::addSwitch(std::unique_ptr<Switch>&& ptrSwitch, const std::string& busId1, const std::string& busId2) {
+Switch& BusBreakerVoltageLevel::addSwitch(NetworkIndex::Ptr<Switch>&& ptrSwitch, const std::string& busId1, const std::string& busId2) {
     unsigned long v1 = *getVertex(busId1, true);
     unsigned long v2 = *getVertex(busId2, true);
 
@@ -49,6 +52,8 @@ Switch& BusBreakerVoltageLevel::addSwitch(std::unique_ptr<Switch>&& ptrSwitch, c
     unsigned long e = m_graph.addEdge(v1, v2, stdcxx::ref(aSwitch));
     m_switches.insert(std::make_pair(aSwitch.getId(), e));
 
+    getNetwork().getListeners().notifyCreation(aSwitch);
+
     return aSwitch;
 }
 
@@ -63,6 +68,9 @@ void BusBreakerVoltageLevel::attach(Terminal& terminal, bool test) {
         auto& busTerminal = dynamic_cast<BusTerminal&>(terminal);
         const auto& connectableBus = getConfiguredBus(busTerminal.getConnectableBusId(), true);
 
+        busTerminal.setIndex(m_terminals.size());
+        m_terminals.emplace_back(std::ref(busTerminal));
+
         getNetwork().getVariantManager().forEachVariant([&connectableBus, &busTerminal, this]() {
             connectableBus.get().addTerminal(busTerminal);
 
@@ -111,6 +119,13 @@ void BusBreakerVoltageLevel::detach(Terminal& terminal) {
     auto& busTerminal = dynamic_cast<BusTerminal&>(terminal);
     auto& bus = getConfiguredBus(busTerminal.getConnectableBusId(), true).get();
 
+    // Keep the terminal index dense by moving the last terminal in place of the detached one
+    const unsigned long index = busTerminal.getIndex();
+    assert(index < m_terminals.size() && stdcxx::areSame(m_terminals[index].get(), busTerminal));
+    m_terminals[index] = m_terminals.back();
+    m_terminals[index].get().setIndex(index);
+    m_terminals.pop_back();
+
     getNetwork().getVariantManager().forEachVariant([&bus, &busTerminal, this]() {
         bus.removeTerminal(busTerminal);
         busTerminal.setConnectableBusId("");
@@ -154,7 +169,13 @@ BusBreakerVoltageLevel::BusView& BusBreakerVoltageLevel::getBusView() {
     return m_busView;
 }
 
+const std::vector<std::reference_wrapper<BusTerminal> >& BusBreakerVoltageLevel::getBusTerminals() const {
+    return m_terminals;
+}
+
 bus_breaker_voltage_level::CalculatedBusTopology& BusBreakerVoltageLevel::getCalculatedBusTopology() {
+    flushCacheInvalidation();
+
     return m_variants.get().getCalculatedBusTopology();
 }
 
@@ -210,6 +231,13 @@ stdcxx::Reference<MergedBus> BusBreakerVoltageLevel::getMergedBus(const std::str
     return getCalculatedBusTopology().getMergedBus(busId, throwException);
 }
 
+stdcxx::Reference<MergedBus> BusBreakerVoltageLevel::getMergedBus(const BusTerminal& terminal) {
+    // A detached terminal has no connectable bus
+    checkNotEmpty(terminal.getConnectableBusId(), "bus id is null");
+
+    return getCalculatedBusTopology().getMergedBus(terminal);
+}
+
 const BusBreakerVoltageLevel::NodeBreakerView& BusBreakerVoltageLevel::getNodeBreakerView() const {
     throw AssertionError("Not implemented");
 }
@@ -287,12 +315,8 @@ stdcxx::optional<unsigned long> BusBreakerVoltageLevel::getVertex(const std::str
     throw PowsyblException(stdcxx::format("Bus '%1%' not found in the voltage level '%2%'", busId, getId()));
 }
 
-void BusBreakerVoltageLevel::invalidateCache() {
+void BusBreakerVoltageLevel::invalidateCalculatedTopology() {
     m_variants.get().getCalculatedBusTopology().invalidateCache();
-    getNetwork().getBusView().invalidateCache();
-    getNetwork().getBusBreakerView().invalidateCache();
-    getNetwork().getConnectedComponentsManager().invalidate();
-    getNetwork().getSynchronousComponentsManager().invalidate();
 }
 
 void BusBreakerVoltageLevel::reduceVariantArraySize(unsigned long number) {
@@ -368,12 +392,7 @@ void BusBreakerVoltageLevel::removeTopology() {
     removeAllBuses();
 }
 
-bool BusBreakerVoltageLevel::traverse(BusTerminal& terminal, Terminal::TopologyTraverser& traverser) const {
-    TerminalSet traversedTerminals;
-    return traverse(terminal, traverser, traversedTerminals);
-}
-
-bool BusBreakerVoltageLevel::traverse(BusTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals) const {
+bool BusBreakerVoltageLevel::traverse(BusTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) const {
     // check if we are allowed to traverse the terminal itself
     math::TraverseResult termTraverseResult = getTraverserResult(traversedTerminals, terminal, traverser);
     if (termTraverseResult == math::TraverseResult::TERMINATE_TRAVERSER) {
@@ -381,7 +400,6 @@ bool BusBreakerVoltageLevel::traverse(BusTerminal& terminal, Terminal::TopologyT
     }
 
     if (termTraverseResult == math::TraverseResult::CONTINUE) {
-        TerminalSet nextTerminals;
         addNextTerminals(terminal, nextTerminals);
 
         // then check we can traverse terminals connected to same bus
@@ -415,12 +433,6 @@ bool BusBreakerVoltageLevel::traverse(BusTerminal& terminal, Terminal::TopologyT
         if (traversalTerminated) {
             return false;
         }
-
-        for (Terminal& nextTerminal : nextTerminals) {
-            if (!nextTerminal.traverse(traverser, traversedTerminals)) {
-                return false;
-            }
-        }
     }
 
     return true;
@@ -8,10 +8,13 @@
 #ifndef POWSYBL_IIDM_BUSBREAKERVOLTAGELEVEL_HPP
 #define POWSYBL_IIDM_BUSBREAKERVOLTAGELEVEL_HPP
 
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
+#include <powsybl/iidm/NetworkIndex.hpp>
 #include <powsybl/iidm/VariantArray.hpp>
 #include <powsybl/iidm/VoltageLevel.hpp>
 #include <powsybl/math/UndirectedGraph.hpp>
@@ -54,21 +57,17 @@ public: // VoltageLevel
 
     const TopologyKind& getTopologyKind() const override;
 
-    void invalidateCache() override;
-
 public:
     BusBreakerVoltageLevel(const std::string& id, const std::string& name, bool fictitious, const stdcxx::Reference<Substation>& substation,
                            Network& network, double nominalV, double lowVoltageLimit, double highVoltagelimit);
 
     ~BusBreakerVoltageLevel() noexcept override = default;
 
-    Bus& addBus(std::unique_ptr<ConfiguredBus>&& ptrBus);
-
-    Switch& addSwitch(std::unique_ptr<Switch>&& ptrSwitch, const std::string& busId1, const std::string& busId2);
+    Bus& addBus(NetworkIndex::Ptr<ConfiguredBus>&& ptrBus);
 
-    bool traverse(BusTerminal& terminal, Terminal::TopologyTraverser& traverser) const;
+    Switch& addSwitch(NetworkIndex::Ptr<Switch>&& ptrSwitch, const std::string& busId1, const std::string& busId2);
 
-    bool traverse(BusTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals) const;
+    bool traverse(BusTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) const;
 
 protected: // MultiVariantObject
     void allocateVariantArrayElement(const std::set<unsigned long>& indexes, unsigned long sourceIndex) override;
@@ -89,6 +88,8 @@ private: // VoltageLevel
 
     NodeBreakerView& getNodeBreakerView() override;
 
+    void invalidateCalculatedTopology() override;
+
     void removeTopology() override;
 
 private:
@@ -103,6 +104,8 @@ private:
 
     stdcxx::Reference<ConfiguredBus> getConfiguredBus(const std::string& busId, bool throwException);
 
+    const std::vector<std::reference_wrapper<BusTerminal> >& getBusTerminals() const;
+
     stdcxx::Reference<ConfiguredBus> getConfiguredBus1(const std::string& switchId);
 
     stdcxx::Reference<ConfiguredBus> getConfiguredBus2(const std::string& switchId);
@@ -113,6 +116,8 @@ private:
 
     stdcxx::Reference<MergedBus> getMergedBus(const std::string& busId, bool throwException);
 
+    stdcxx::Reference<MergedBus> getMergedBus(const BusTerminal& terminal);
+
     stdcxx::Reference<Switch> getSwitch(const std::string& switchId, bool throwException);
 
     stdcxx::optional<unsigned long> getVertex(const std::string& busId, bool throwException) const;
@@ -143,6 +148,9 @@ private:
 
     std::map<std::string, unsigned long> m_switches;
 
+    // The attached terminals, by index: the calculated topologies label them with their bus in a dense array
+    std::vector<std::reference_wrapper<BusTerminal> > m_terminals;
+
     bus_breaker_voltage_level::VariantArray m_variants;
 
     bus_breaker_voltage_level::BusBreakerViewImpl m_busBreakerView;
@@ -8,6 +8,7 @@
 #include "BusBreakerVoltageLevelBusCache.hpp"
 
 #include <cassert>
+#include <memory>
 
 #include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/adaptor/map.hpp>
@@ -18,9 +19,14 @@ namespace iidm {
 
 namespace bus_breaker_voltage_level {
 
-BusCache::BusCache(MergedBusById mergedBus, MergedBusByConfiguredBus mapping) :
+BusCache::BusCache(MergedBusById mergedBus, MergedBusByConfiguredBus mapping, MergedBusByTerminal mergedBusByTerminal) :
     m_mergedBus(std::move(mergedBus)),
-    m_mapping(std::move(mapping)) {
+    m_mapping(std::move(mapping)),
+    m_mergedBusByTerminal(std::move(mergedBusByTerminal)) {
+
+    for (const auto& it : m_mapping) {
+        ++m_configuredBusCount[&it.second.get()];
+    }
 }
 
 stdcxx::Reference<MergedBus> BusCache::getMergedBus(const std::string& id) const {
@@ -37,6 +43,12 @@ stdcxx::Reference<MergedBus> BusCache::getMergedBus(const stdcxx::Reference<Conf
     return (it == m_mapping.end()) ? stdcxx::ref<MergedBus>() : stdcxx::ref<MergedBus>(it->second);
 }
 
+stdcxx::Reference<MergedBus> BusCache::getMergedBus(unsigned long terminalIndex) const {
+    assert(terminalIndex < m_mergedBusByTerminal.size());
+
+    return m_mergedBusByTerminal[terminalIndex];
+}
+
 stdcxx::const_range<MergedBus> BusCache::getMergedBuses() const {
     return boost::adaptors::values(m_mergedBus) | boost::adaptors::indirected;
 }
@@ -45,6 +57,27 @@ stdcxx::range<MergedBus> BusCache::getMergedBuses() {
     return boost::adaptors::values(m_mergedBus) | boost::adaptors::indirected;
 }
 
+std::unique_ptr<MergedBus> BusCache::releaseMergedBus(const std::string& id, const MergedBus::BusSet& buses) {
+    const auto& it = m_mergedBus.find(id);
+    if (it == m_mergedBus.end() || !it->second) {
+        return std::unique_ptr<MergedBus>();
+    }
+
+    // The configured buses are compared through the mapping, as an invalidated merged bus has forgotten them
+    const MergedBus* mergedBus = it->second.get();
+    if (m_configuredBusCount[mergedBus] != buses.size()) {
+        return std::unique_ptr<MergedBus>();
+    }
+    for (const auto& bus : buses) {
+        const auto& itMapping = m_mapping.find(bus);
+        if (itMapping == m_mapping.end() || std::addressof(itMapping->second.get()) != mergedBus) {
+            return std::unique_ptr<MergedBus>();
+        }
+    }
+
+    return std::move(it->second);
+}
+
 }  // namespace bus_breaker_voltage_level
 
 }  // namespace iidm
@@ -30,8 +30,11 @@ public:
 
     using MergedBusByConfiguredBus = std::map<std::reference_wrapper<ConfiguredBus>, std::reference_wrapper<MergedBus>, stdcxx::less<ConfiguredBus> >;
 
+    // The merged bus of the connectable bus of each terminal, indexed by the terminal index in the voltage level
+    using MergedBusByTerminal = std::vector<stdcxx::Reference<MergedBus> >;
+
 public:
-    BusCache(MergedBusById mergedBus, MergedBusByConfiguredBus mapping);
+    BusCache(MergedBusById mergedBus, MergedBusByConfiguredBus mapping, MergedBusByTerminal mergedBusByTerminal);
 
     ~BusCache() noexcept = default;
 
@@ -39,14 +42,27 @@ public:
 
     stdcxx::Reference<MergedBus> getMergedBus(const stdcxx::Reference<ConfiguredBus>& bus) const;
 
+    stdcxx::Reference<MergedBus> getMergedBus(unsigned long terminalIndex) const;
+
     stdcxx::const_range<MergedBus> getMergedBuses() const;
 
     stdcxx::range<MergedBus> getMergedBuses();
 
+    /**
+     * Take the ownership of a merged bus of this cache, if it aggregates exactly the given configured buses.
+     *
+     * @return the merged bus or nullptr if there is no merged bus with this id or if its configured buses differ
+     */
+    std::unique_ptr<MergedBus> releaseMergedBus(const std::string& id, const MergedBus::BusSet& buses);
+
 private:
     MergedBusById m_mergedBus;
 
     MergedBusByConfiguredBus m_mapping;
+
+    MergedBusByTerminal m_mergedBusByTerminal;
+
+    std::unordered_map<const MergedBus*, unsigned long> m_configuredBusCount;
 };
 
 }  // namespace bus_breaker_voltage_level
@@ -7,6 +7,9 @@
 
 #include "BusBreakerVoltageLevelTopology.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include <powsybl/AssertionError.hpp>
 #include <powsybl/iidm/Switch.hpp>
 #include <powsybl/math/TraverseResult.hpp>
@@ -16,6 +19,7 @@
 #include <powsybl/stdcxx/set.hpp>
 
 #include "BusBreakerVoltageLevel.hpp"
+#include "BusTerminal.hpp"
 
 namespace powsybl {
 
@@ -27,11 +31,48 @@ CalculatedBusTopology::CalculatedBusTopology(BusBreakerVoltageLevel& voltageLeve
     m_voltageLevel(voltageLevel) {
 }
 
-std::unique_ptr<MergedBus> CalculatedBusTopology::createMergedBus(unsigned long busCount, const MergedBus::BusSet& busSet) const {
-    const std::string& mergedBusId = stdcxx::format("%1%_%2%", m_voltageLevel.getId(), busCount);
-    const std::string& mergedBusName = m_voltageLevel.getOptionalName().empty() ? "" : stdcxx::format("%1%_%2%", m_voltageLevel.getOptionalName(), busCount);
+std::unique_ptr<MergedBus> CalculatedBusTopology::createMergedBus(unsigned long vertex, MergedBus::BusSet busSet) {
+    // The merged bus is identified by the smallest vertex of its configured buses, which does not depend on the
+    // other merged buses of the voltage level
+    const std::string& mergedBusId = stdcxx::format("%1%_%2%", m_voltageLevel.getId(), vertex);
+    const std::string& mergedBusName = m_voltageLevel.getOptionalName().empty() ? "" : stdcxx::format("%1%_%2%", m_voltageLevel.getOptionalName(), vertex);
+
+    if (static_cast<bool>(m_previousCache)) {
+        std::unique_ptr<MergedBus> mergedBus = m_previousCache->releaseMergedBus(mergedBusId, busSet);
+        if (static_cast<bool>(mergedBus) && mergedBus->getOptionalName() == mergedBusName && mergedBus->isFictitious() == m_voltageLevel.isFictitious()) {
+            mergedBus->validate(std::move(busSet));
+            return mergedBus;
+        }
+    }
+
+    return stdcxx::make_unique<MergedBus>(mergedBusId, mergedBusName, m_voltageLevel.isFictitious(), std::move(busSet));
+}
+
+std::vector<long> CalculatedBusTopology::getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses) {
+    updateCache();
+
+    // The cache already maps each terminal to its bus: number the buses in the order of their first terminal
+    const auto& busTerminals = m_voltageLevel.getBusTerminals();
+    std::vector<long> busIndexByTerminal(busTerminals.size(), -1);
+    std::unordered_map<const MergedBus*, long> busIndexes;
+
+    terminals.clear();
+    buses.clear();
+    for (unsigned long index = 0; index < busTerminals.size(); ++index) {
+        const BusTerminal& terminal = busTerminals[index].get();
+        terminals.emplace_back(stdcxx::cref<Terminal>(terminal));
+
+        const stdcxx::Reference<MergedBus>& bus = m_cache->getMergedBus(index);
+        if (static_cast<bool>(bus) && terminal.isConnected()) {
+            const auto& it = busIndexes.emplace(&bus.get(), static_cast<long>(buses.size()));
+            if (it.second) {
+                buses.emplace_back(stdcxx::cref<Bus>(bus));
+            }
+            busIndexByTerminal[index] = it.first->second;
+        }
+    }
 
-    return stdcxx::make_unique<MergedBus>(mergedBusId, mergedBusName, m_voltageLevel.isFictitious(), busSet);
+    return busIndexByTerminal;
 }
 
 stdcxx::Reference<MergedBus> CalculatedBusTopology::getMergedBus(const std::string& id, bool throwException) {
@@ -51,6 +92,12 @@ stdcxx::Reference<MergedBus> CalculatedBusTopology::getMergedBus(const stdcxx::R
     return m_cache->getMergedBus(bus);
 }
 
+stdcxx::Reference<MergedBus> CalculatedBusTopology::getMergedBus(const BusTerminal& terminal) {
+    updateCache();
+
+    return m_cache->getMergedBus(terminal.getIndex());
+}
+
 stdcxx::range<MergedBus> CalculatedBusTopology::getMergedBuses() {
     updateCache();
 
@@ -63,7 +110,7 @@ void CalculatedBusTopology::invalidateCache() {
             bus.invalidate();
         }
 
-        m_cache.reset();
+        m_previousCache = std::move(m_cache);
     }
 }
 
@@ -109,10 +156,9 @@ void CalculatedBusTopology::updateCache() {
         return;
     }
 
-    unsigned long busCount = 0;
-
     BusCache::MergedBusById mergedBuses;
     BusCache::MergedBusByConfiguredBus mapping;
+    BusCache::MergedBusByTerminal mergedBusByTerminal(m_voltageLevel.getBusTerminals().size());
 
     const auto& graph = m_voltageLevel.getGraph();
 
@@ -122,31 +168,37 @@ void CalculatedBusTopology::updateCache() {
 
             MergedBus::BusSet busSet;
             busSet.push_back(std::ref(graph.getVertexObject(v).get()));
+            unsigned long minVertex = v;
 
-            graph.traverse(v, [&busSet, &graph](unsigned long /*v1*/, unsigned long e, unsigned long v2) {
+            graph.traverse(v, [&busSet, &graph, &minVertex](unsigned long /*v1*/, unsigned long e, unsigned long v2) {
                 stdcxx::Reference<Switch> aSwitch = graph.getEdgeObject(e);
                 if (aSwitch.get().isOpen()) {
                     return math::TraverseResult::TERMINATE_PATH;
                 }
 
                 busSet.push_back(std::ref(graph.getVertexObject(v2).get()));
+                minVertex = std::min(minVertex, v2);
                 return math::TraverseResult::CONTINUE;
             }, encountered);
 
             if (isBusValid(busSet)) {
-                std::unique_ptr<MergedBus> ptrMergedBus = createMergedBus(busCount++, busSet);
+                std::unique_ptr<MergedBus> ptrMergedBus = createMergedBus(minVertex, busSet);
 
                 const auto& it = mergedBuses.insert(std::make_pair(ptrMergedBus->getId(), std::move(ptrMergedBus)));
                 const std::reference_wrapper<MergedBus>& mergedBus = std::ref(*it.first->second);
 
-                std::for_each(busSet.begin(), busSet.end(), [&mapping, &mergedBus](const std::reference_wrapper<ConfiguredBus>& bus) {
+                std::for_each(busSet.begin(), busSet.end(), [&mapping, &mergedBus, &mergedBusByTerminal](const std::reference_wrapper<ConfiguredBus>& bus) {
                     mapping.insert(std::make_pair(bus, mergedBus));
+                    for (const BusTerminal& terminal : bus.get().getTerminals()) {
+                        mergedBusByTerminal[terminal.getIndex()] = stdcxx::ref(mergedBus.get());
+                    }
                 });
             }
         }
     }
 
-    m_cache = stdcxx::make_unique<BusCache>(std::move(mergedBuses), std::move(mapping));
+    m_cache = stdcxx::make_unique<BusCache>(std::move(mergedBuses), std::move(mapping), std::move(mergedBusByTerminal));
+    m_previousCache.reset();
 }
 
 }  // namespace bus_breaker_voltage_level
@@ -21,6 +21,10 @@ namespace powsybl {
 
 namespace iidm {
 
+class Bus;
+class BusTerminal;
+class Terminal;
+
 namespace bus_breaker_voltage_level {
 
 class CalculatedBusTopology {
@@ -29,10 +33,14 @@ public:
 
     ~CalculatedBusTopology() noexcept = default;
 
+    std::vector<long> getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses);
+
     stdcxx::Reference<MergedBus> getMergedBus(const std::string& id, bool throwException);
 
     stdcxx::Reference<MergedBus> getMergedBus(const stdcxx::Reference<ConfiguredBus>& bus);
 
+    stdcxx::Reference<MergedBus> getMergedBus(const BusTerminal& terminal);
+
     stdcxx::range<MergedBus> getMergedBuses();
 
     void invalidateCache();
@@ -40,7 +48,7 @@ public:
     void updateCache();
 
 private:
-    std::unique_ptr<MergedBus> createMergedBus(unsigned long busCount, const MergedBus::BusSet& busSet) const;
+    std::unique_ptr<MergedBus> createMergedBus(unsigned long vertex, MergedBus::BusSet busSet);
 
     bool isBusValid(const MergedBus::BusSet& buses) const;
 
@@ -48,6 +56,9 @@ private:
     BusBreakerVoltageLevel& m_voltageLevel;
 
     std::unique_ptr<BusCache> m_cache;
+
+    // The cache dropped by the last invalidation, whose merged buses can be reused by the next update
+    std::unique_ptr<BusCache> m_previousCache;
 };
 
 }  // namespace bus_breaker_voltage_level
@@ -146,6 +146,10 @@ stdcxx::Reference<Bus> BusViewImpl::getBus(const std::string& busId) {
     return stdcxx::ref<Bus>(m_voltageLevel.getMergedBus(busId, false));
 }
 
+std::vector<long> BusViewImpl::getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses) const {
+    return m_voltageLevel.getCalculatedBusTopology().getBusIndexByTerminal(terminals, buses);
+}
+
 stdcxx::const_range<Bus> BusViewImpl::getBuses() const {
     const auto& mergedBuses = m_voltageLevel.getCalculatedBusTopology().getMergedBuses();
 
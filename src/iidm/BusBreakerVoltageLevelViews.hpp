@@ -76,6 +76,8 @@ public:
 
     stdcxx::Reference<Bus> getBus(const std::string& busId) override;
 
+    std::vector<long> getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses) const override;
+
     stdcxx::const_range<Bus> getBuses() const override;
 
     stdcxx::range<Bus> getBuses() override;
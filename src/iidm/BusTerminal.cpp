@@ -8,6 +8,8 @@
 #include "BusTerminal.hpp"
 
 #include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/StringPool.hpp>
 #include <powsybl/iidm/ValidationUtils.hpp>
 #include <powsybl/iidm/VariantManager.hpp>
 #include <powsybl/stdcxx/demangle.hpp>
@@ -22,7 +24,7 @@ namespace iidm {
 BusTerminal::BusTerminal(VoltageLevel& voltageLevel, const std::string& connectableBusId, bool connected) :
     Terminal(voltageLevel),
     m_connected(voltageLevel.getNetwork().getVariantManager().getVariantArraySize(), connected),
-    m_connectableBusId(voltageLevel.getNetwork().getVariantManager().getVariantArraySize(), checkNotEmpty(connectableBusId, "ConnectableBusId is required")),
+    m_connectableBusId(voltageLevel.getNetwork().getVariantManager().getVariantArraySize(), std::cref(voltageLevel.getNetwork().getStringPool().intern(checkNotEmpty(connectableBusId, "ConnectableBusId is required")))),
     m_busBreakerView(*this),
     m_busView(*this) {
 }
@@ -39,7 +41,7 @@ void BusTerminal::allocateVariantArrayElement(const std::set<unsigned long>& ind
 void BusTerminal::deleteVariantArrayElement(unsigned long index) {
     Terminal::deleteVariantArrayElement(index);
 
-    m_connectableBusId[index] = "";
+    m_connectableBusId[index] = std::cref(StringPool::getEmptyString());
 }
 
 void BusTerminal::extendVariantArraySize(unsigned long initVariantArraySize, unsigned long number, unsigned long sourceIndex) {
@@ -50,7 +52,7 @@ void BusTerminal::extendVariantArraySize(unsigned long initVariantArraySize, uns
 }
 
 const std::string& BusTerminal::getConnectableBusId() const {
-    return m_connectableBusId[getNetwork().getVariantIndex()];
+    return m_connectableBusId[getNetwork().getVariantIndex()].get();
 }
 
 double BusTerminal::getAngle() const {
@@ -75,6 +77,10 @@ BusTerminal::BusView& BusTerminal::getBusView() {
     return m_busView;
 }
 
+unsigned long BusTerminal::getIndex() const {
+    return m_index;
+}
+
 const BusTerminal::NodeBreakerView& BusTerminal::getNodeBreakerView() const {
     throw AssertionError("Not implemented");
 }
@@ -97,11 +103,11 @@ void BusTerminal::reduceVariantArraySize(unsigned long number) {
     Terminal::reduceVariantArraySize(number);
 
     m_connected.resize(m_connected.size() - number);
-    m_connectableBusId.resize(m_connectableBusId.size() - number);
+    m_connectableBusId.resize(m_connectableBusId.size() - number, std::cref(StringPool::getEmptyString()));
 }
 
 BusTerminal& BusTerminal::setConnectableBusId(const std::string& connectableBusId) {
-    m_connectableBusId[getNetwork().getVariantIndex()] = connectableBusId;
+    m_connectableBusId[getNetwork().getVariantIndex()] = std::cref(getNetwork().getStringPool().intern(connectableBusId));
 
     return *this;
 }
@@ -112,14 +118,15 @@ BusTerminal& BusTerminal::setConnected(bool connected) {
     return *this;
 }
 
-bool BusTerminal::traverse(TopologyTraverser& traverser) {
-    auto& voltageLevel = dynamic_cast<BusBreakerVoltageLevel&>(getVoltageLevel());
-    return voltageLevel.traverse(*this, traverser);
+BusTerminal& BusTerminal::setIndex(unsigned long index) {
+    m_index = index;
+
+    return *this;
 }
 
-bool BusTerminal::traverse(TopologyTraverser& traverser, TerminalSet& traversedTerminals) {
+bool BusTerminal::traverseVoltageLevel(TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) {
     auto& voltageLevel = dynamic_cast<BusBreakerVoltageLevel&>(getVoltageLevel());
-    return voltageLevel.traverse(*this, traverser, traversedTerminals);
+    return voltageLevel.traverse(*this, traverser, traversedTerminals, nextTerminals);
 }
 
 std::ostream& operator<<(std::ostream& stream, const BusTerminal& busTerminal) {
@@ -8,6 +8,7 @@
 #ifndef POWSYBL_IIDM_BUSTERMINAL_HPP
 #define POWSYBL_IIDM_BUSTERMINAL_HPP
 
+#include <functional>
 #include <iosfwd>
 #include <set>
 #include <string>
@@ -48,10 +49,6 @@ public: // Terminal
 
     bool isConnected() const override;
 
-    bool traverse(TopologyTraverser& traverser) override;
-
-    bool traverse(TopologyTraverser& traverser, TerminalSet& traversedTerminals) override;
-
 public:
     BusTerminal(VoltageLevel& voltageLevel, const std::string& connectableBusId, bool connected);
 
@@ -67,10 +64,17 @@ public:
 
     const std::string& getConnectableBusId() const;
 
+    /**
+     * Return the position of this terminal in the dense terminal index of its voltage level
+     */
+    unsigned long getIndex() const;
+
     BusTerminal& setConnectableBusId(const std::string& connectableBusId);
 
     BusTerminal& setConnected(bool connected);
 
+    BusTerminal& setIndex(unsigned long index);
+
 protected: // MultiVariantObject
     void allocateVariantArrayElement(const std::set<unsigned long>& indexes, unsigned long sourceIndex) override;
 
@@ -80,10 +84,16 @@ protected: // MultiVariantObject
 
     void reduceVariantArraySize(unsigned long number) override;
 
+private: // Terminal
+    bool traverseVoltageLevel(TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) override;
+
 private:
     std::vector<bool> m_connected;
 
-    std::vector<std::string> m_connectableBusId;
+    // Interned in the string pool of the network: a variant only holds a reference to the id
+    std::vector<std::reference_wrapper<const std::string> > m_connectableBusId;
+
+    unsigned long m_index = 0;
 
     bus_terminal::BusBreakerViewImpl m_busBreakerView;
 
@@ -70,17 +70,13 @@ stdcxx::Reference<Bus> BusViewImpl::getBus() {
 stdcxx::CReference<Bus> BusViewImpl::getConnectableBus() const {
     auto& voltageLevel = dynamic_cast<BusBreakerVoltageLevel&>(m_terminal.getVoltageLevel());
 
-    const auto& configuredBus = voltageLevel.getConfiguredBus(m_terminal.getConnectableBusId(), true);
-
-    return stdcxx::cref<Bus>(voltageLevel.getCalculatedBusTopology().getMergedBus(configuredBus));
+    return stdcxx::cref<Bus>(voltageLevel.getMergedBus(m_terminal));
 }
 
 stdcxx::Reference<Bus> BusViewImpl::getConnectableBus() {
     auto& voltageLevel = dynamic_cast<BusBreakerVoltageLevel&>(m_terminal.getVoltageLevel());
 
-    const auto& configuredBus = voltageLevel.getConfiguredBus(m_terminal.getConnectableBusId(), true);
-
-    return stdcxx::ref<Bus>(voltageLevel.getCalculatedBusTopology().getMergedBus(configuredBus));
+    return stdcxx::ref<Bus>(voltageLevel.getMergedBus(m_terminal));
 }
 
 }  // namespace bus_terminal
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/BusViewSnapshot.hpp>
+
+#include <algorithm>
+
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Connectable.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+BusViewSnapshot::Bus::Bus(std::string id, std::string voltageLevelId, double v, double angle, std::vector<std::string>&& connectableIds) :
+    m_id(std::move(id)),
+    m_voltageLevelId(std::move(voltageLevelId)),
+    m_v(v),
+    m_angle(angle),
+    m_connectableIds(std::move(connectableIds)) {
+}
+
+double BusViewSnapshot::Bus::getAngle() const {
+    return m_angle;
+}
+
+const std::vector<std::string>& BusViewSnapshot::Bus::getConnectableIds() const {
+    return m_connectableIds;
+}
+
+const std::string& BusViewSnapshot::Bus::getId() const {
+    return m_id;
+}
+
+double BusViewSnapshot::Bus::getV() const {
+    return m_v;
+}
+
+const std::string& BusViewSnapshot::Bus::getVoltageLevelId() const {
+    return m_voltageLevelId;
+}
+
+BusViewSnapshot::BusViewSnapshot(const Network& network) :
+    m_topologyGeneration(network.getTopologyGeneration()),
+    m_variantIndex(network.getVariantIndex()) {
+
+    for (const iidm::Bus& bus : network.getBusView().getBuses()) {
+        std::vector<std::string> connectableIds;
+        connectableIds.reserve(bus.getConnectedTerminalCount());
+        for (const Terminal& terminal : bus.getConnectedTerminals()) {
+            connectableIds.emplace_back(terminal.getConnectable().get().getId());
+        }
+        m_buses.emplace_back(bus.getId(), bus.getVoltageLevel().getId(), bus.getV(), bus.getAngle(), std::move(connectableIds));
+    }
+
+    std::sort(m_buses.begin(), m_buses.end(), [](const Bus& bus1, const Bus& bus2) {
+        return bus1.getId() < bus2.getId();
+    });
+}
+
+stdcxx::CReference<BusViewSnapshot::Bus> BusViewSnapshot::getBus(const std::string& id) const {
+    const auto& it = std::lower_bound(m_buses.begin(), m_buses.end(), id, [](const Bus& bus, const std::string& busId) {
+        return bus.getId() < busId;
+    });
+
+    return (it != m_buses.end() && it->getId() == id) ? stdcxx::cref<Bus>(*it) : stdcxx::cref<Bus>();
+}
+
+const std::vector<BusViewSnapshot::Bus>& BusViewSnapshot::getBuses() const {
+    return m_buses;
+}
+
+unsigned long BusViewSnapshot::getTopologyGeneration() const {
+    return m_topologyGeneration;
+}
+
+unsigned long BusViewSnapshot::getVariantIndex() const {
+    return m_variantIndex;
+}
+
+bool BusViewSnapshot::isUpToDate(const Network& network) const {
+    return network.getTopologyGeneration() == m_topologyGeneration && network.getVariantIndex() == m_variantIndex;
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
@@ -25,12 +25,14 @@ BusbarSectionAdder::BusbarSectionAdder(NodeBreakerVoltageLevel& voltageLevel) :
 BusbarSection& BusbarSectionAdder::add() {
     checkOptional(*this, m_node, "Node is not set");
 
-    std::unique_ptr<BusbarSection> ptrBusbarSection = stdcxx::make_unique<BusbarSection>(checkAndGetUniqueId(), getName(), isFictitious());
+    NetworkIndex::Ptr<BusbarSection> ptrBusbarSection = getNetwork().createIdentifiable<BusbarSection>(checkAndGetUniqueId(), getName(), isFictitious());
     BusbarSection& busbarSection = getNetwork().checkAndAdd(std::move(ptrBusbarSection));
 
     Terminal& terminal = busbarSection.addTerminal(createNodeTerminal(m_voltageLevel, *m_node));
     m_voltageLevel.attach(terminal, false);
 
+    getNetwork().getListeners().notifyCreation(busbarSection);
+
     return busbarSection;
 }
 
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ComponentNumberArray.hpp"
+
+#include <limits>
+
+#include <powsybl/AssertionError.hpp>
+#include <powsybl/stdcxx/format.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+namespace {
+
+constexpr std::uint32_t NO_NUMBER = std::numeric_limits<std::uint32_t>::max();
+
+}  // namespace
+
+ComponentNumberArray::ComponentNumberArray(unsigned long size, const stdcxx::optional<unsigned long>& number) :
+    m_numbers(size, encode(number)) {
+}
+
+std::uint32_t ComponentNumberArray::encode(const stdcxx::optional<unsigned long>& number) {
+    if (!number) {
+        return NO_NUMBER;
+    }
+    if (*number >= NO_NUMBER) {
+        throw AssertionError(stdcxx::format("Component number %1% out of range", *number));
+    }
+    return static_cast<std::uint32_t>(*number);
+}
+
+stdcxx::optional<unsigned long> ComponentNumberArray::get(unsigned long index) const {
+    const std::uint32_t number = m_numbers[index];
+    return number == NO_NUMBER ? stdcxx::optional<unsigned long>() : stdcxx::optional<unsigned long>(number);
+}
+
+void ComponentNumberArray::resize(unsigned long size, const stdcxx::optional<unsigned long>& number) {
+    m_numbers.resize(size, encode(number));
+}
+
+void ComponentNumberArray::set(unsigned long index, const stdcxx::optional<unsigned long>& number) {
+    m_numbers[index] = encode(number);
+}
+
+unsigned long ComponentNumberArray::size() const {
+    return m_numbers.size();
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_COMPONENTNUMBERARRAY_HPP
+#define POWSYBL_IIDM_COMPONENTNUMBERARRAY_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <powsybl/stdcxx/optional.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+/**
+ * The optional component numbers of a bus or a terminal, one per variant.
+ *
+ * The numbers are stored on 32 bits, and the absence of number is encoded by a sentinel value, so that each variant
+ * takes 4 bytes instead of the 16 bytes of an optional.
+ */
+class ComponentNumberArray {
+public:
+    ComponentNumberArray(unsigned long size, const stdcxx::optional<unsigned long>& number);
+
+    ~ComponentNumberArray() noexcept = default;
+
+    stdcxx::optional<unsigned long> get(unsigned long index) const;
+
+    void resize(unsigned long size, const stdcxx::optional<unsigned long>& number = stdcxx::optional<unsigned long>());
+
+    void set(unsigned long index, const stdcxx::optional<unsigned long>& number);
+
+    unsigned long size() const;
+
+private:
+    static std::uint32_t encode(const stdcxx::optional<unsigned long>& number);
+
+private:
+    std::vector<std::uint32_t> m_numbers;
+};
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_COMPONENTNUMBERARRAY_HPP
@@ -50,8 +50,8 @@ void ConfiguredBus::allocateVariantArrayElement(const std::set<unsigned long>& i
         m_terminals[index] = m_terminals[sourceIndex];
         m_v[index] = m_v[sourceIndex];
         m_angle[index] = m_angle[sourceIndex];
-        m_connectedComponentNumber[index] = m_connectedComponentNumber[sourceIndex];
-        m_synchronousComponentNumber[index] = m_synchronousComponentNumber[sourceIndex];
+        m_connectedComponentNumber.set(index, m_connectedComponentNumber.get(sourceIndex));
+        m_synchronousComponentNumber.set(index, m_synchronousComponentNumber.get(sourceIndex));
     }
 }
 
@@ -67,8 +67,8 @@ void ConfiguredBus::extendVariantArraySize(unsigned long initVariantArraySize, u
     m_terminals.resize(m_terminals.size() + number, m_terminals[sourceIndex]);
     m_v.resize(m_v.size() + number, m_v[sourceIndex]);
     m_angle.resize(m_angle.size() + number, m_angle[sourceIndex]);
-    m_connectedComponentNumber.resize(m_connectedComponentNumber.size() + number, m_connectedComponentNumber[sourceIndex]);
-    m_synchronousComponentNumber.resize(m_synchronousComponentNumber.size() + number, m_synchronousComponentNumber[sourceIndex]);
+    m_connectedComponentNumber.resize(m_connectedComponentNumber.size() + number, m_connectedComponentNumber.get(sourceIndex));
+    m_synchronousComponentNumber.resize(m_synchronousComponentNumber.size() + number, m_synchronousComponentNumber.get(sourceIndex));
 }
 
 double ConfiguredBus::getAngle() const {
@@ -78,7 +78,7 @@ double ConfiguredBus::getAngle() const {
 stdcxx::CReference<Component> ConfiguredBus::getConnectedComponent() const {
     ConnectedComponentsManager& ccm = m_voltageLevel.get().getNetwork().getConnectedComponentsManager();
     ccm.update();
-    return stdcxx::cref<Component>(ccm.getComponent(m_connectedComponentNumber[getNetwork().getVariantIndex()]));
+    return stdcxx::cref<Component>(ccm.getComponent(m_connectedComponentNumber.get(getNetwork().getVariantIndex())));
 }
 
 stdcxx::Reference<Component> ConfiguredBus::getConnectedComponent() {
@@ -125,7 +125,7 @@ stdcxx::range<Terminal> ConfiguredBus::getConnectedTerminals() {
 stdcxx::CReference<Component> ConfiguredBus::getSynchronousComponent() const {
     SynchronousComponentsManager& scm = m_voltageLevel.get().getNetwork().getSynchronousComponentsManager();
     scm.update();
-    return stdcxx::cref<Component>(scm.getComponent(m_synchronousComponentNumber[getNetwork().getVariantIndex()]));
+    return stdcxx::cref<Component>(scm.getComponent(m_synchronousComponentNumber.get(getNetwork().getVariantIndex())));
 }
 
 stdcxx::Reference<Component> ConfiguredBus::getSynchronousComponent() {
@@ -195,12 +195,12 @@ Bus& ConfiguredBus::setAngle(double angle) {
 
 void ConfiguredBus::setConnectedComponentNumber(const stdcxx::optional<unsigned long>& connectedComponentNumber) {
     unsigned long variantIndex = getNetwork().getVariantIndex();
-    m_connectedComponentNumber[variantIndex] = connectedComponentNumber;
+    m_connectedComponentNumber.set(variantIndex, connectedComponentNumber);
 }
 
 void ConfiguredBus::setSynchronousComponentNumber(const stdcxx::optional<unsigned long>& synchronousComponentNumber) {
     unsigned long variantIndex = getNetwork().getVariantIndex();
-    m_synchronousComponentNumber[variantIndex] = synchronousComponentNumber;
+    m_synchronousComponentNumber.set(variantIndex, synchronousComponentNumber);
 }
 
 Bus& ConfiguredBus::setV(double v) {
@@ -15,6 +15,8 @@
 #include <powsybl/iidm/BusAdder.hpp>
 #include <powsybl/stdcxx/reference.hpp>
 
+#include "ComponentNumberArray.hpp"
+
 namespace powsybl {
 
 namespace iidm {
@@ -91,9 +93,9 @@ private:
 
     std::vector<double> m_angle;
 
-    std::vector<stdcxx::optional<unsigned long>> m_connectedComponentNumber;
+    ComponentNumberArray m_connectedComponentNumber;
 
-    std::vector<stdcxx::optional<unsigned long>> m_synchronousComponentNumber;
+    ComponentNumberArray m_synchronousComponentNumber;
 };
 
 }  // namespace iidm
@@ -30,12 +30,12 @@ std::unique_ptr<Component> ConnectedComponentsManager::createComponent(Network&
     return stdcxx::make_unique<Component, ConnectedComponent>(network, num, size);
 }
 
-void ConnectedComponentsManager::fillAdjacencyList(const std::map<std::string, unsigned long>& id2num, std::vector<std::vector<unsigned long>>& adjacencyList) const {
-    AbstractComponentsManager::fillAdjacencyList(id2num, adjacencyList);
+void ConnectedComponentsManager::fillAdjacencyList(const std::unordered_map<const Bus*, unsigned long>& bus2num, std::vector<std::vector<unsigned long>>& adjacencyList) const {
+    AbstractComponentsManager::fillAdjacencyList(bus2num, adjacencyList);
     for (const HvdcLine& line : getNetwork().getHvdcLines()) {
         const auto& bus1 = line.getConverterStation1().get().getTerminal().getBusView().getBus();
         const auto& bus2 = line.getConverterStation2().get().getTerminal().getBusView().getBus();
-        addToAdjacencyList(bus1, bus2, id2num, adjacencyList);
+        addToAdjacencyList(bus1, bus2, bus2num, adjacencyList);
     }
 }
 
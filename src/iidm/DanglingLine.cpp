@@ -138,13 +138,19 @@ DanglingLine& DanglingLine::setG(double g) {
 }
 
 DanglingLine& DanglingLine::setP0(double p0) {
-    m_p0[getNetwork().getVariantIndex()] = checkP0(*this, p0);
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_p0[variantIndex];
+    m_p0[variantIndex] = checkP0(*this, p0);
+    notifyUpdate("p0", variantIndex, oldValue, m_p0[variantIndex]);
 
     return *this;
 }
 
 DanglingLine& DanglingLine::setQ0(double q0) {
-    m_q0[getNetwork().getVariantIndex()] = checkQ0(*this, q0);
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_q0[variantIndex];
+    m_q0[variantIndex] = checkQ0(*this, q0);
+    notifyUpdate("q0", variantIndex, oldValue, m_q0[variantIndex]);
 
     return *this;
 }
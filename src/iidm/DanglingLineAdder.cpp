@@ -32,13 +32,15 @@ DanglingLine& DanglingLineAdder::add() {
 
     std::unique_ptr<DanglingLine::Generation> ptrGeneration = m_generationAdder ? m_generationAdder->build() : nullptr;
 
-    std::unique_ptr<DanglingLine> ptrDanglingLine = stdcxx::make_unique<DanglingLine>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(),
+    NetworkIndex::Ptr<DanglingLine> ptrDanglingLine = getNetwork().createIdentifiable<DanglingLine>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(),
                                                                                       m_p0, m_q0, m_r, m_x, m_g, m_b, m_ucteXnodeCode, std::move(ptrGeneration));
     auto& danglingLine = getNetwork().checkAndAdd<DanglingLine>(std::move(ptrDanglingLine));
 
     Terminal& terminal = danglingLine.addTerminal(checkAndGetTerminal());
     getVoltageLevel().attach(terminal, false);
 
+    getNetwork().getListeners().notifyCreation(danglingLine);
+
     return danglingLine;
 }
 
@@ -7,6 +7,8 @@
 
 #include <powsybl/iidm/Extendable.hpp>
 
+#include <algorithm>
+
 #include <boost/range/adaptor/indirected.hpp>
 #include <boost/range/adaptor/map.hpp>
 
@@ -18,36 +20,76 @@ namespace powsybl {
 namespace iidm {
 
 Extendable::Extendable(Extendable&& extendable) noexcept :
-    m_extensionsByName(std::move(extendable.m_extensionsByName)),
-    m_extensionsByType(std::move(extendable.m_extensionsByType)) {
+    m_extensions(std::move(extendable.m_extensions)) {
 
-    for (auto& it : m_extensionsByName) {
+    for (auto& it : m_extensions) {
         it.second->setExtendable(*this);
     }
 }
 
 void Extendable::addExtension(std::unique_ptr<Extension>&& extension) {
-    auto it = m_extensionsByName.find(extension->getName());
-    if (it != m_extensionsByName.end()) {
-        // Clean the existing extension
-        it->second->setExtendable(stdcxx::ref<Extendable>());
-        m_extensionsByName.erase(extension->getName());
-        m_extensionsByType.erase(extension->getType());
+    const unsigned long slot = Extension::getSlot(extension->getType());
+
+    // Clean the existing extension of the same name or the same type
+    for (auto it = m_extensions.begin(); it != m_extensions.end();) {
+        if (it->first == slot || it->second->getName() == extension->getName()) {
+            onExtensionRemoved(it->first, *it->second);
+            it->second->setExtendable(stdcxx::ref<Extendable>());
+            it = m_extensions.erase(it);
+        } else {
+            ++it;
+        }
     }
 
     extension->setExtendable(*this);
-    auto newIt = m_extensionsByName.emplace(extension->getName(), std::move(extension));
+    const auto& position = std::lower_bound(m_extensions.begin(), m_extensions.end(), extension->getName(), [](const ExtensionSlot& item, const std::string& name) {
+        return item.second->getName() < name;
+    });
+    Extension& refExtension = *m_extensions.emplace(position, slot, std::move(extension))->second;
+
+    onExtensionAdded(slot, refExtension);
+}
 
-    std::reference_wrapper<Extension> refExtension = *newIt.first->second;
-    m_extensionsByType.emplace(refExtension.get().getType(), refExtension);
+const Extension* Extendable::findExtensionByName(const std::string& name) const {
+    const auto& it = std::lower_bound(m_extensions.begin(), m_extensions.end(), name, [](const ExtensionSlot& item, const std::string& value) {
+        return item.second->getName() < value;
+    });
+    return it != m_extensions.end() && it->second->getName() == name ? it->second.get() : nullptr;
+}
+
+const Extension* Extendable::findExtensionBySlot(unsigned long slot) const {
+    for (const auto& it : m_extensions) {
+        if (it.first == slot) {
+            return it.second.get();
+        }
+    }
+    return nullptr;
 }
 
 stdcxx::const_range<Extension> Extendable::getExtensions() const {
-    return boost::adaptors::values(m_extensionsByName) | boost::adaptors::indirected;
+    return boost::adaptors::values(m_extensions) | boost::adaptors::indirected;
 }
 
 stdcxx::range<Extension> Extendable::getExtensions() {
-    return boost::adaptors::values(m_extensionsByName) | boost::adaptors::indirected;
+    return boost::adaptors::values(m_extensions) | boost::adaptors::indirected;
+}
+
+void Extendable::onExtensionAdded(unsigned long /*slot*/, Extension& /*extension*/) {
+    // Nothing to do
+}
+
+void Extendable::onExtensionRemoved(unsigned long /*slot*/, Extension& /*extension*/) {
+    // Nothing to do
+}
+
+void Extendable::removeExtensionBySlot(unsigned long slot) {
+    const auto& it = std::find_if(m_extensions.begin(), m_extensions.end(), [slot](const ExtensionSlot& item) {
+        return item.first == slot;
+    });
+    if (it != m_extensions.end()) {
+        onExtensionRemoved(it->first, *it->second);
+        m_extensions.erase(it);
+    }
 }
 
 }  // namespace iidm
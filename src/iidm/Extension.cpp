@@ -7,6 +7,9 @@
 
 #include <powsybl/iidm/Extension.hpp>
 
+#include <mutex>
+#include <unordered_map>
+
 #include <powsybl/stdcxx/format.hpp>
 #include <powsybl/stdcxx/memory.hpp>
 
@@ -18,6 +21,15 @@ Extension::Extension(powsybl::iidm::Extendable& extendable) :
     m_extendable(extendable) {
 }
 
+unsigned long Extension::getSlot(const std::type_index& type) {
+    static std::mutex s_mutex;
+    static std::unordered_map<std::type_index, unsigned long> s_slots;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const unsigned long slot = s_slots.size();
+    return s_slots.emplace(type, slot).first->second;
+}
+
 void Extension::setExtendable(powsybl::iidm::Extendable& extendable) {
     setExtendable(stdcxx::ref(extendable));
 }
@@ -125,7 +125,10 @@ void Generator::reduceVariantArraySize(unsigned long number) {
 }
 
 Generator& Generator::setActivePowerSetpoint(double activePowerSetpoint) {
-    m_activePowerSetpoint[getNetwork().getVariantIndex()] = checkActivePowerSetpoint(*this, activePowerSetpoint);
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_activePowerSetpoint[variantIndex];
+    m_activePowerSetpoint[variantIndex] = checkActivePowerSetpoint(*this, activePowerSetpoint);
+    notifyUpdate("targetP", variantIndex, oldValue, m_activePowerSetpoint[variantIndex]);
     return *this;
 }
 
@@ -155,7 +158,10 @@ Generator& Generator::setRatedS(double ratedS) {
 
 Generator& Generator::setReactivePowerSetpoint(double reactivePowerSetpoint) {
     checkVoltageControl(*this, isVoltageRegulatorOn(), getVoltageSetpoint(), reactivePowerSetpoint);
-    m_reactivePowerSetpoint[getNetwork().getVariantIndex()] = reactivePowerSetpoint;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_reactivePowerSetpoint[variantIndex];
+    m_reactivePowerSetpoint[variantIndex] = reactivePowerSetpoint;
+    notifyUpdate("targetQ", variantIndex, oldValue, m_reactivePowerSetpoint[variantIndex]);
     return *this;
 }
 
@@ -183,13 +189,19 @@ Generator& Generator::setTargetV(double voltageSetpoint) {
 
 Generator& Generator::setVoltageRegulatorOn(bool voltageRegulatorOn) {
     checkVoltageControl(*this, voltageRegulatorOn, getTargetV(), getTargetQ());
-    m_voltageRegulatorOn[getNetwork().getVariantIndex()] = voltageRegulatorOn;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    bool oldValue = m_voltageRegulatorOn[variantIndex];
+    m_voltageRegulatorOn[variantIndex] = voltageRegulatorOn;
+    notifyUpdate("voltageRegulatorOn", variantIndex, oldValue, m_voltageRegulatorOn[variantIndex]);
     return *this;
 }
 
 Generator& Generator::setVoltageSetpoint(double voltageSetpoint) {
     checkVoltageControl(*this, isVoltageRegulatorOn(), voltageSetpoint, getReactivePowerSetpoint());
-    m_voltageSetpoint[getNetwork().getVariantIndex()] = voltageSetpoint;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_voltageSetpoint[variantIndex];
+    m_voltageSetpoint[variantIndex] = voltageSetpoint;
+    notifyUpdate("targetV", variantIndex, oldValue, m_voltageSetpoint[variantIndex]);
     return *this;
 }
 
@@ -34,7 +34,7 @@ Generator& GeneratorAdder::add() {
 
     auto terminalPtr = checkAndGetTerminal();
     Terminal& regulatingTerminal = m_regulatingTerminal ? m_regulatingTerminal : *terminalPtr;
-    std::unique_ptr<Generator> ptrGenerator = stdcxx::make_unique<Generator>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(),
+    NetworkIndex::Ptr<Generator> ptrGenerator = getNetwork().createIdentifiable<Generator>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(),
         m_energySource, m_minP, m_maxP, *m_voltageRegulatorOn, regulatingTerminal,
         m_activePowerSetpoint, m_reactivePowerSetpoint, m_voltageSetpoint, m_ratedS);
     auto& generator = getNetwork().checkAndAdd(std::move(ptrGenerator));
@@ -42,6 +42,8 @@ Generator& GeneratorAdder::add() {
     Terminal& terminal = generator.addTerminal(std::move(terminalPtr));
     getVoltageLevel().attach(terminal, false);
 
+    getNetwork().getListeners().notifyCreation(generator);
+
     return generator;
 }
 
@@ -138,7 +138,10 @@ void HvdcLine::remove() {
 }
 
 HvdcLine& HvdcLine::setActivePowerSetpoint(double activePowerSetpoint) {
-    m_activePowerSetpoint[getNetwork().getVariantIndex()] = checkHvdcActivePowerSetpoint(*this, activePowerSetpoint);
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_activePowerSetpoint[variantIndex];
+    m_activePowerSetpoint[variantIndex] = checkHvdcActivePowerSetpoint(*this, activePowerSetpoint);
+    notifyUpdate("activePowerSetpoint", variantIndex, oldValue, m_activePowerSetpoint[variantIndex]);
 
     return *this;
 }
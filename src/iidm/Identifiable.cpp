@@ -8,11 +8,15 @@
 #include <powsybl/iidm/Identifiable.hpp>
 
 #include <boost/range/adaptor/map.hpp>
+#include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/join.hpp>
 
+#include <powsybl/iidm/Network.hpp>
 #include <powsybl/iidm/ValidationUtils.hpp>
+#include <powsybl/stdcxx/exception.hpp>
 #include <powsybl/stdcxx/format.hpp>
 #include <powsybl/stdcxx/instanceof.hpp>
+#include <powsybl/stdcxx/math.hpp>
 
 namespace stdcxx {
 
@@ -63,7 +67,7 @@ void Identifiable::addAlias(const std::string& alias, const std::string& aliasTy
         if (aliasType.empty()) {
             m_aliasesWithoutType.emplace(uniqueAlias);
         } else {
-            m_aliasesByType[aliasType] = uniqueAlias;
+            m_aliasesByType.emplace(std::cref(getNetwork().getStringPool().intern(aliasType)), uniqueAlias);
         }
     }
 }
@@ -112,10 +116,10 @@ std::string Identifiable::getAliasType(const std::string& alias) const {
     if (m_aliasesWithoutType.find(alias) != m_aliasesWithoutType.end()) {
         return "";
     }
-    auto it = std::find_if(m_aliasesByType.begin(), m_aliasesByType.end(), [&alias](const std::pair<std::string, std::string>& entry) {
+    auto it = std::find_if(m_aliasesByType.begin(), m_aliasesByType.end(), [&alias](const std::pair<const InternedString, std::string>& entry) {
         return entry.second == alias;
     });
-    return it != m_aliasesByType.end() ? it->first : "";
+    return it != m_aliasesByType.end() ? it->first.get() : "";
 }
 
 const std::string& Identifiable::getId() const {
@@ -135,15 +139,24 @@ const std::string& Identifiable::getOptionalName() const {
 }
 
 const std::string& Identifiable::getProperty(const std::string& key) const {
-    return m_properties.get(key);
+    const auto& it = m_properties.find(key);
+    if (it == m_properties.end()) {
+        throw stdcxx::PropertyNotFoundException(stdcxx::format("Property %1% does not exist", key));
+    }
+    return it->second;
 }
 
 const std::string& Identifiable::getProperty(const std::string& key, const std::string& defaultValue) const {
-    return m_properties.get(key, defaultValue);
+    const auto& it = m_properties.find(key);
+    return it != m_properties.end() ? it->second : defaultValue;
 }
 
 stdcxx::const_range<std::string> Identifiable::getPropertyNames() const {
-    return m_properties.getKeys();
+    const auto& mapper = [](const InternedString& key) -> const std::string& {
+        return key.get();
+    };
+
+    return m_properties | boost::adaptors::map_keys | boost::adaptors::transformed(mapper);
 }
 
 bool Identifiable::hasAliases() const {
@@ -151,17 +164,32 @@ bool Identifiable::hasAliases() const {
 }
 
 bool Identifiable::hasProperty() const {
-    return !m_properties.isEmpty();
+    return !m_properties.empty();
 }
 
 bool Identifiable::hasProperty(const std::string& key) const {
-    return m_properties.contains(key);
+    return m_properties.find(key) != m_properties.end();
 }
 
 bool Identifiable::isFictitious() const {
     return m_fictitious;
 }
 
+void Identifiable::notifyUpdate(const char* attribute, unsigned long variantIndex, double oldValue, double newValue) {
+    const NetworkListenerList& listeners = getNetwork().getListeners();
+    if (!listeners.empty() && !stdcxx::isEqual(oldValue, newValue)) {
+        listeners.notifyUpdate(*this, attribute, variantIndex, oldValue, newValue);
+    }
+}
+
+void Identifiable::onExtensionAdded(unsigned long slot, Extension& /*extension*/) {
+    getNetwork().m_networkIndex.addExtendedIdentifiable(slot, *this);
+}
+
+void Identifiable::onExtensionRemoved(unsigned long slot, Extension& /*extension*/) {
+    getNetwork().m_networkIndex.removeExtendedIdentifiable(slot, *this);
+}
+
 void Identifiable::reduceVariantArraySize(unsigned long number) {
     for (Extension& extension : getExtensions()) {
         if (stdcxx::isInstanceOf<MultiVariantObject>(extension)) {
@@ -172,7 +200,7 @@ void Identifiable::reduceVariantArraySize(unsigned long number) {
 
 void Identifiable::removeAlias(const std::string& alias) {
     getNetwork().getIndex().removeAlias(*this, alias);
-    auto it = std::find_if(m_aliasesByType.begin(), m_aliasesByType.end(), [&alias](const std::pair<std::string, std::string>& entry) {
+    auto it = std::find_if(m_aliasesByType.begin(), m_aliasesByType.end(), [&alias](const std::pair<const InternedString, std::string>& entry) {
         return entry.second == alias;
     });
     if (it != m_aliasesByType.end()) {
@@ -183,15 +211,24 @@ void Identifiable::removeAlias(const std::string& alias) {
 }
 
 bool Identifiable::removeProperty(const std::string& key) {
-    return static_cast<bool>(m_properties.remove(key));
+    return m_properties.erase(key) > 0;
 }
 
 void Identifiable::setFictitious(bool fictitious) {
+    bool oldValue = m_fictitious;
     m_fictitious = fictitious;
+    notifyUpdate("fictitious", getNetwork().getVariantIndex(), oldValue, fictitious);
 }
 
 stdcxx::optional<std::string> Identifiable::setProperty(const std::string& key, const std::string& value) {
-    return m_properties.set(key, value);
+    const auto& it = m_properties.find(key);
+    if (it != m_properties.end()) {
+        std::string oldValue = std::move(it->second);
+        it->second = value;
+        return oldValue;
+    }
+    m_properties.emplace(std::cref(getNetwork().getStringPool().intern(key)), value);
+    return {};
 }
 
 std::ostream& operator<<(std::ostream& stream, const Identifiable& identifiable) {
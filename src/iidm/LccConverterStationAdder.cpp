@@ -23,12 +23,14 @@ LccConverterStationAdder::LccConverterStationAdder(VoltageLevel& voltageLevel) :
 LccConverterStation& LccConverterStationAdder::add() {
     validate();
 
-    std::unique_ptr<LccConverterStation> ptrLcc = stdcxx::make_unique<LccConverterStation>(checkAndGetUniqueId(), getName(), isFictitious(), getLossFactor(), m_powerFactor);
+    NetworkIndex::Ptr<LccConverterStation> ptrLcc = getNetwork().createIdentifiable<LccConverterStation>(checkAndGetUniqueId(), getName(), isFictitious(), getLossFactor(), m_powerFactor);
     auto& lcc = getNetwork().checkAndAdd<LccConverterStation>(std::move(ptrLcc));
 
     Terminal& terminal = lcc.addTerminal(checkAndGetTerminal());
     getVoltageLevel().attach(terminal, false);
 
+    getNetwork().getListeners().notifyCreation(lcc);
+
     return lcc;
 }
 
@@ -7,15 +7,32 @@
 
 #include <powsybl/iidm/LoadingLimits.hpp>
 
+#include <algorithm>
+
 #include <boost/range/adaptor/map.hpp>
 
+#include <powsybl/PowsyblException.hpp>
 #include <powsybl/iidm/ValidationUtils.hpp>
+#include <powsybl/stdcxx/format.hpp>
 #include <powsybl/stdcxx/math.hpp>
 
 namespace powsybl {
 
 namespace iidm {
 
+namespace {
+
+template <typename Iterator>
+Iterator findTemporaryLimit(Iterator begin, Iterator end, unsigned long acceptableDuration) {
+    // The temporary limits are sorted by decreasing acceptable duration
+    auto it = std::lower_bound(begin, end, acceptableDuration, [](const LoadingLimits::TemporaryLimit& tl, unsigned long duration) {
+        return tl.getAcceptableDuration() > duration;
+    });
+    return (it != end && it->getAcceptableDuration() == acceptableDuration) ? it : end;
+}
+
+}  // namespace
+
 LoadingLimits::TemporaryLimit::TemporaryLimit(const std::string& name, double value, unsigned long acceptableDuration, bool hasOverloadingProtection) :
     m_name(name),
     m_value(value),
@@ -42,9 +59,17 @@ bool LoadingLimits::TemporaryLimit::isFictitious() const {
 LoadingLimits::LoadingLimits(OperationalLimitsOwner& owner, double permanentLimit, const TemporaryLimits& temporaryLimits, 
 const FictitiousLimits& fictitiousLimits) :
     OperationalLimits(owner),
-    m_permanentLimit(permanentLimit),
-    m_temporaryLimits(temporaryLimits),
-    m_fictitiousLimits(fictitiousLimits) {
+    m_permanentLimit(permanentLimit) {
+
+    // The maps are already sorted: flatten them in the same order
+    m_temporaryLimits.reserve(temporaryLimits.size());
+    for (const TemporaryLimit& tl : temporaryLimits | boost::adaptors::map_values) {
+        m_temporaryLimits.push_back(tl);
+    }
+    m_fictitiousLimits.reserve(fictitiousLimits.size());
+    for (const TemporaryLimit& tl : fictitiousLimits | boost::adaptors::map_values) {
+        m_fictitiousLimits.push_back(tl);
+    }
 }
 
 double LoadingLimits::getPermanentLimit() const {
@@ -52,32 +77,36 @@ double LoadingLimits::getPermanentLimit() const {
 }
 
 const LoadingLimits::TemporaryLimit& LoadingLimits::getTemporaryLimit(unsigned long acceptableDuration) const {
-    return m_temporaryLimits.at(acceptableDuration);
+    auto it = findTemporaryLimit(m_temporaryLimits.cbegin(), m_temporaryLimits.cend(), acceptableDuration);
+    if (it == m_temporaryLimits.cend()) {
+        throw PowsyblException(stdcxx::format("Temporary limit with acceptable duration %1% not found", acceptableDuration));
+    }
+    return *it;
 }
 
 LoadingLimits::TemporaryLimit& LoadingLimits::getTemporaryLimit(unsigned long acceptableDuration) {
-    return m_temporaryLimits.at(acceptableDuration);
+    return const_cast<TemporaryLimit&>(static_cast<const LoadingLimits*>(this)->getTemporaryLimit(acceptableDuration));
 }
 
 stdcxx::const_range<LoadingLimits::TemporaryLimit> LoadingLimits::getTemporaryLimits() const {
-    return m_temporaryLimits | boost::adaptors::map_values;
+    return m_temporaryLimits;
 }
 
 stdcxx::range<LoadingLimits::TemporaryLimit> LoadingLimits::getTemporaryLimits() {
-    return m_temporaryLimits | boost::adaptors::map_values;
+    return m_temporaryLimits;
 }
 
 stdcxx::const_range<LoadingLimits::TemporaryLimit> LoadingLimits::getFictitiousLimits() const {
-    return m_fictitiousLimits | boost::adaptors::map_values;
+    return m_fictitiousLimits;
 }
 
 stdcxx::range<LoadingLimits::TemporaryLimit> LoadingLimits::getFictitiousLimits() {
-    return m_fictitiousLimits | boost::adaptors::map_values;
+    return m_fictitiousLimits;
 }
 
 double LoadingLimits::getTemporaryLimitValue(unsigned long acceptableDuration) const {
-    auto tl = m_temporaryLimits.find(acceptableDuration);
-    return (tl != m_temporaryLimits.end()) ? tl->second.getValue() : stdcxx::nan();
+    auto it = findTemporaryLimit(m_temporaryLimits.cbegin(), m_temporaryLimits.cend(), acceptableDuration);
+    return (it != m_temporaryLimits.cend()) ? it->getValue() : stdcxx::nan();
 }
 
 LoadingLimits& LoadingLimits::setPermanentLimit(double permanentLimit) {
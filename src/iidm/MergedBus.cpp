@@ -182,6 +182,11 @@ Bus& MergedBus::setV(double v) {
     return *this;
 }
 
+void MergedBus::validate(BusSet buses) {
+    m_buses = std::move(buses);
+    m_valid = true;
+}
+
 void MergedBus::visitConnectedOrConnectableEquipments(TopologyVisitor& visitor) {
     checkValidity();
     for (ConfiguredBus& bus : m_buses) {
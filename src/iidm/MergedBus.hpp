@@ -83,6 +83,12 @@ public:
      */
     void invalidate();
 
+    /**
+     * Make this bus valid again after the voltage level topology changed, when its set of buses is unchanged
+     * @param buses the list of ConfiguredBus aggregated in this bus
+     */
+    void validate(BusSet buses);
+
 private:
     void checkValidity() const;
 
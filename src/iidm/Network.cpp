@@ -7,6 +7,7 @@
 
 #include <powsybl/iidm/Network.hpp>
 
+#include <cassert>
 #include <sstream>
 #include <unordered_set>
 
@@ -41,6 +42,7 @@
 
 #include <powsybl/stdcxx/Properties.hpp>
 #include <powsybl/stdcxx/hash.hpp>
+#include <powsybl/stdcxx/parallel.hpp>
 
 #include "converter/xml/NetworkXml.hpp"
 
@@ -79,7 +81,7 @@ Network::Network(const std::string& id, const std::string& sourceFormat) :
     m_variants(*this, [this]() { return stdcxx::make_unique<network::VariantImpl>(*this); }),
     m_busBreakerView(*this),
     m_busView(*this) {
-    checkAndAdd(std::unique_ptr<Network>(this));
+    checkAndAdd(NetworkIndex::Ptr<Network>(this));
 }
 
 Network::Network(Network&& network) noexcept :
@@ -88,19 +90,56 @@ Network::Network(Network&& network) noexcept :
     m_caseDate(std::move(network.m_caseDate)),
     m_forecastDistance(network.m_forecastDistance),
     m_sourceFormat(std::move(network.m_sourceFormat)),
+    m_stringPool(std::move(network.m_stringPool)),
     m_networkIndex(*this, std::move(network.m_networkIndex)),
+    m_listeners(std::move(network.m_listeners)),
     m_variantManager(*this, std::move(network.m_variantManager)),
     m_variants(*this, std::move(network.m_variants)),
+    m_topologyGeneration(network.m_topologyGeneration),
+    m_topologyBatchDepth(network.m_topologyBatchDepth),
+    m_batchedVoltageLevelIds(std::move(network.m_batchedVoltageLevelIds)),
     m_busBreakerView(*this),
     m_busView(*this) {
 }
 
+void Network::addListener(NetworkListener& listener) {
+    m_listeners.add(listener);
+}
+
 void Network::allocateVariantArrayElement(const std::set<unsigned long>& indexes, unsigned long sourceIndex) {
     Container::allocateVariantArrayElement(indexes, sourceIndex);
 
     m_variants.allocateVariantArrayElement(indexes, [this, sourceIndex]() { return m_variants.copy(sourceIndex); });
 }
 
+void Network::beginTopologyBatch() {
+    ++m_topologyBatchDepth;
+}
+
+void Network::commitTopologyBatch() {
+    assert(m_topologyBatchDepth > 0);
+    if (--m_topologyBatchDepth > 0) {
+        return;
+    }
+
+    getVariantManager().forEachVariant([this]() {
+        flushCacheInvalidations();
+    });
+
+    // Forget the invalidations of the variants removed during the batch
+    for (const std::string& voltageLevelId : m_batchedVoltageLevelIds) {
+        const stdcxx::Reference<VoltageLevel>& voltageLevel = find<VoltageLevel>(voltageLevelId);
+        if (static_cast<bool>(voltageLevel)) {
+            voltageLevel.get().m_pendingInvalidations.clear();
+        }
+    }
+    m_batchedVoltageLevelIds.clear();
+}
+
+void Network::deferCacheInvalidation(const VoltageLevel& voltageLevel) {
+    m_batchedVoltageLevelIds.insert(voltageLevel.getId());
+}
+
 void Network::deleteVariantArrayElement(unsigned long index) {
     Container::deleteVariantArrayElement(index);
 
@@ -125,6 +164,16 @@ stdcxx::Reference<HvdcLine> Network::findHvdcLine(const HvdcConverterStation& st
     return stdcxx::ref(const_cast<const Network*>(this)->findHvdcLine(station));
 }
 
+void Network::flushCacheInvalidations() {
+    // Voltage levels removed during the batch are skipped
+    for (const std::string& voltageLevelId : m_batchedVoltageLevelIds) {
+        const stdcxx::Reference<VoltageLevel>& voltageLevel = find<VoltageLevel>(voltageLevelId);
+        if (static_cast<bool>(voltageLevel)) {
+            voltageLevel.get().flushCacheInvalidation();
+        }
+    }
+}
+
 const Battery& Network::getBattery(const std::string& id) const {
     return get<Battery>(id);
 }
@@ -420,6 +469,10 @@ stdcxx::range<Line> Network::getLines() {
         m_networkIndex.getAll<TieLine, Line>());
 }
 
+const NetworkListenerList& Network::getListeners() const {
+    return m_listeners;
+}
+
 const Load& Network::getLoad(const std::string& id) const {
     return get<Load>(id);
 }
@@ -500,6 +553,14 @@ stdcxx::range<StaticVarCompensator> Network::getStaticVarCompensators() {
     return m_networkIndex.getAll<StaticVarCompensator>();
 }
 
+const StringPool& Network::getStringPool() const {
+    return m_stringPool;
+}
+
+StringPool& Network::getStringPool() {
+    return m_stringPool;
+}
+
 const Substation& Network::getSubstation(const std::string& id) const {
     return get<Substation>(id);
 }
@@ -568,6 +629,10 @@ stdcxx::range<ThreeWindingsTransformer> Network::getThreeWindingsTransformers()
     return m_networkIndex.getAll<ThreeWindingsTransformer>();
 }
 
+unsigned long Network::getTopologyGeneration() const {
+    return m_topologyGeneration;
+}
+
 const TwoWindingsTransformer& Network::getTwoWindingsTransformer(const std::string& id) const {
     return get<TwoWindingsTransformer>(id);
 }
@@ -651,6 +716,21 @@ unsigned long Network::getVscConverterStationCount() const {
     return getObjectCount<VscConverterStation>();
 }
 
+void Network::incrementTopologyGeneration() {
+    ++m_topologyGeneration;
+}
+
+void Network::invalidateTopologyCache() {
+    getBusBreakerView().invalidateCache();
+    getBusView().invalidateCache();
+    getConnectedComponentsManager().invalidate();
+    getSynchronousComponentsManager().invalidate();
+}
+
+bool Network::isInTopologyBatch() const {
+    return m_topologyBatchDepth > 0;
+}
+
 HvdcLineAdder Network::newHvdcLine() {
     return HvdcLineAdder(*this);
 }
@@ -679,6 +759,37 @@ VoltageLevelAdder Network::newVoltageLevel() {
     return VoltageLevelAdder(*this);
 }
 
+void Network::precomputeTopology(unsigned long threadCount) {
+    // The deferred invalidations update the network caches, so they are applied before sharing the voltage levels
+    flushCacheInvalidations();
+
+    std::vector<std::reference_wrapper<VoltageLevel>> voltageLevels;
+    voltageLevels.reserve(getVoltageLevelCount());
+    for (VoltageLevel& voltageLevel : getVoltageLevels()) {
+        voltageLevels.emplace_back(std::ref(voltageLevel));
+    }
+
+    // With a thread local variant context, the threads have to select the working variant themselves
+    VariantManager& variantManager = getVariantManager();
+    const bool selectVariant = variantManager.isVariantMultiThreadAccessAllowed();
+    const std::string workingVariantId = variantManager.getWorkingVariantId();
+
+    // The calculated topologies only depend on the voltage level they belong to
+    stdcxx::parallelFor(voltageLevels.size(), threadCount, [&voltageLevels, &variantManager, selectVariant, &workingVariantId](unsigned long /*chunk*/, unsigned long begin, unsigned long end) {
+        if (selectVariant) {
+            variantManager.setWorkingVariant(workingVariantId);
+        }
+        for (unsigned long i = begin; i < end; ++i) {
+            VoltageLevel& voltageLevel = voltageLevels[i].get();
+            voltageLevel.getBusBreakerView().getBuses();
+            voltageLevel.getBusView().getBuses();
+        }
+    });
+
+    getBusBreakerViewCache().getCache();
+    getBusViewCache().getCache();
+}
+
 void Network::reduceVariantArraySize(unsigned long number) {
     Container::reduceVariantArraySize(number);
 
@@ -686,7 +797,19 @@ void Network::reduceVariantArraySize(unsigned long number) {
 }
 
 void Network::remove(Identifiable& identifiable) {
+    if (m_listeners.empty()) {
+        m_networkIndex.remove(identifiable);
+        return;
+    }
+
+    m_listeners.notifyBeforeRemoval(identifiable);
+    const std::string id = identifiable.getId();
     m_networkIndex.remove(identifiable);
+    m_listeners.notifyAfterRemoval(id);
+}
+
+void Network::removeListener(NetworkListener& listener) {
+    m_listeners.remove(listener);
 }
 
 Network& Network::setCaseDate(const stdcxx::DateTime& caseDate) {
@@ -13,9 +13,9 @@
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/join.hpp>
 
+#include <powsybl/AssertionError.hpp>
 #include <powsybl/iidm/Substation.hpp>
 #include <powsybl/iidm/ValidationUtils.hpp>
-#include <powsybl/stdcxx/map.hpp>
 #include <powsybl/stdcxx/memory.hpp>
 
 #include "BusBreakerVoltageLevel.hpp"
@@ -27,19 +27,22 @@ namespace iidm {
 
 /**
  * This functor overrides the default deleter of the {@link std::unique_ptr}.
- * Delete the pointer for all {@link Identifiable} subclasses except {@link Network}.
+ * Destroy the object for all {@link Identifiable} subclasses except {@link Network}: their memory belongs to the arena.
  *
  * This hack allows to store the network instance in the NetworkIndex without a double-free corruption.
  */
 void NetworkIndex::Deleter::operator()(Identifiable* ptr) const {
     if (!stdcxx::isInstanceOf<Network, Identifiable>(ptr)) {
-        delete ptr;
+        ptr->~Identifiable();
     }
 }
 
 NetworkIndex::NetworkIndex(Network& network, NetworkIndex&& networkIndex) noexcept :
+    m_arena(std::move(networkIndex.m_arena)),
     m_objectsById(std::move(networkIndex.m_objectsById)),
-    m_objectsByType(std::move(networkIndex.m_objectsByType)) {
+    m_objectsByType(std::move(networkIndex.m_objectsByType)),
+    m_idByAlias(std::move(networkIndex.m_idByAlias)),
+    m_identifiablesByExtension(std::move(networkIndex.m_identifiablesByExtension)) {
 
     // Replace the references to the old network by the new one
     m_objectsById[network.getId()].reset(&network);
@@ -68,8 +71,7 @@ bool NetworkIndex::addAlias(const Identifiable& obj, const std::string& alias) {
     }
     auto aliasIter = m_idByAlias.find(alias);
     if (aliasIter != m_idByAlias.end()) {
-        const std::string& id = aliasIter->second;
-        const Identifiable& aliasConflict = *m_objectsById[id];
+        const Identifiable& aliasConflict = *m_objectsById.find(aliasIter->second.get())->second;
         if (stdcxx::areSame(aliasConflict, obj)) {
             // Silently ignore affecting the same alias twice to an object
             return false;
@@ -78,17 +80,33 @@ bool NetworkIndex::addAlias(const Identifiable& obj, const std::string& alias) {
                                                     stdcxx::demangle(obj), alias, stdcxx::demangle(aliasConflict), aliasConflict.getId());
         throw PowsyblException(message);
     }
-    m_idByAlias.emplace(alias, obj.getId());
+    const auto& it = m_objectsById.find(obj.getId());
+    if (it == m_objectsById.end() || !stdcxx::areSame(*it->second, obj)) {
+        throw AssertionError(stdcxx::format("Object '%1%' is not indexed", obj.getId()));
+    }
+    m_idByAlias.emplace(alias, std::cref(it->first));
     return true;
 }
 
+void NetworkIndex::addExtendedIdentifiable(unsigned long slot, Identifiable& identifiable) {
+    const auto& it = m_objectsById.find(identifiable.getId());
+    if (it == m_objectsById.end() || !stdcxx::areSame(*it->second, identifiable)) {
+        return;
+    }
+    if (slot >= m_identifiablesByExtension.size()) {
+        m_identifiablesByExtension.resize(slot + 1);
+    }
+    m_identifiablesByExtension[slot].emplace(std::cref(it->first), std::ref(*it));
+}
+
 void NetworkIndex::checkId(const std::string& id) {
     checkNotEmpty(id, "Invalid id '" + id + "'");
 }
 
 template <>
 stdcxx::CReference<Identifiable> NetworkIndex::find(const std::string& id) const {
-    const auto& resolvedId = stdcxx::getOrDefault(m_idByAlias, id, id);
+    const auto& aliasIter = m_idByAlias.find(id);
+    const std::string& resolvedId = aliasIter != m_idByAlias.end() ? aliasIter->second.get() : id;
     checkId(resolvedId);
 
     const auto& it = m_objectsById.find(resolvedId);
@@ -145,6 +163,28 @@ stdcxx::range<VoltageLevel> NetworkIndex::getAll<VoltageLevel, VoltageLevel>() {
     return boost::range::join(getAll<BusBreakerVoltageLevel, VoltageLevel>(), getAll<NodeBreakerVoltageLevel, VoltageLevel>());
 }
 
+stdcxx::const_range<Identifiable> NetworkIndex::getExtendedIdentifiables(unsigned long slot) const {
+    static const ExtendedIdentifiables s_noIdentifiables;
+
+    const auto& mapper = [](const std::reference_wrapper<IdentifiableById::value_type>& item) -> const Identifiable& {
+        return *item.get().second;
+    };
+
+    const ExtendedIdentifiables& identifiables = slot < m_identifiablesByExtension.size() ? m_identifiablesByExtension[slot] : s_noIdentifiables;
+    return boost::adaptors::values(identifiables) | boost::adaptors::transformed(mapper);
+}
+
+stdcxx::range<Identifiable> NetworkIndex::getExtendedIdentifiables(unsigned long slot) {
+    static const ExtendedIdentifiables s_noIdentifiables;
+
+    const auto& mapper = [](const std::reference_wrapper<IdentifiableById::value_type>& item) -> Identifiable& {
+        return *item.get().second;
+    };
+
+    const ExtendedIdentifiables& identifiables = slot < m_identifiablesByExtension.size() ? m_identifiablesByExtension[slot] : s_noIdentifiables;
+    return boost::adaptors::values(identifiables) | boost::adaptors::transformed(mapper);
+}
+
 template <>
 unsigned long NetworkIndex::getObjectCount<Identifiable>() const {
     return m_objectsById.size();
@@ -170,6 +210,10 @@ void NetworkIndex::remove(Identifiable& identifiable) {
             for (const std::string& alias : identifiable.getAliases()) {
                 m_idByAlias.erase(alias);
             }
+            // The extended identifiables refer to the entry which is erased
+            for (ExtendedIdentifiables& extendedIdentifiables : m_identifiablesByExtension) {
+                extendedIdentifiables.erase(std::cref(it->first));
+            }
 
             identifiables.erase(itIdentifiable);
             m_objectsById.erase(identifiable.getId());
@@ -182,12 +226,22 @@ void NetworkIndex::removeAlias(const Identifiable& obj, const std::string& alias
     if (it == m_idByAlias.end()) {
         throw PowsyblException(stdcxx::format("No alias '%1%' found in the network", alias));
     }
-    if (it->second != obj.getId()) {
+    if (it->second.get() != obj.getId()) {
         throw PowsyblException(stdcxx::format("Alias '%1%' does not correspond to object '%2%'", alias, obj.getId()));
     }
     m_idByAlias.erase(it);
 }
 
+void NetworkIndex::removeExtendedIdentifiable(unsigned long slot, const Identifiable& identifiable) {
+    if (slot < m_identifiablesByExtension.size()) {
+        ExtendedIdentifiables& identifiables = m_identifiablesByExtension[slot];
+        const auto& it = identifiables.find(std::cref(identifiable.getId()));
+        if (it != identifiables.end() && stdcxx::areSame(*it->second.get().second, identifiable)) {
+            identifiables.erase(it);
+        }
+    }
+}
+
 }  // namespace iidm
 
 }  // namespace powsybl
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/NetworkJournal.hpp>
+
+#include <powsybl/PowsyblException.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/StringPool.hpp>
+#include <powsybl/stdcxx/format.hpp>
+#include <powsybl/stdcxx/math.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+NetworkJournal::NetworkJournal(Network& network, unsigned long capacity) :
+    m_network(network),
+    m_capacity(capacity) {
+
+    if (capacity == 0) {
+        throw PowsyblException("Network journal capacity must be > 0");
+    }
+    m_events.reserve(capacity);
+    network.addListener(*this);
+}
+
+NetworkJournal::~NetworkJournal() noexcept {
+    m_network.get().removeListener(*this);
+}
+
+void NetworkJournal::afterRemoval(const std::string& id) {
+    record(EventType::REMOVAL, id, StringPool::getEmptyString(), m_network.get().getVariantIndex(), stdcxx::nan(), stdcxx::nan());
+}
+
+void NetworkJournal::clear() {
+    m_events.clear();
+    m_recordedEventCount = 0;
+}
+
+unsigned long NetworkJournal::getCapacity() const {
+    return m_capacity;
+}
+
+const NetworkJournal::Event& NetworkJournal::getEvent(unsigned long index) const {
+    if (index >= m_events.size()) {
+        throw PowsyblException(stdcxx::format("Event index %1% out of range [0, %2%)", index, m_events.size()));
+    }
+    // Once the buffer is full, the oldest event is the next one to be overwritten
+    const unsigned long first = m_recordedEventCount > m_capacity ? m_recordedEventCount % m_capacity : 0;
+    return m_events[(first + index) % m_capacity];
+}
+
+unsigned long NetworkJournal::getEventCount() const {
+    return m_events.size();
+}
+
+unsigned long NetworkJournal::getRecordedEventCount() const {
+    return m_recordedEventCount;
+}
+
+void NetworkJournal::onCreation(const Identifiable& identifiable) {
+    record(EventType::CREATION, identifiable.getId(), StringPool::getEmptyString(), m_network.get().getVariantIndex(), stdcxx::nan(), stdcxx::nan());
+}
+
+void NetworkJournal::onUpdate(const Identifiable& identifiable, const std::string& attribute, unsigned long variantIndex, double oldValue, double newValue) {
+    record(EventType::UPDATE, identifiable.getId(), attribute, variantIndex, oldValue, newValue);
+}
+
+void NetworkJournal::record(EventType type, const std::string& id, const std::string& attribute, unsigned long variantIndex, double oldValue, double newValue) {
+    StringPool& stringPool = m_network.get().getStringPool();
+    Event event = {type, std::cref(stringPool.intern(id)), std::cref(stringPool.intern(attribute)), variantIndex, oldValue, newValue};
+    if (m_events.size() < m_capacity) {
+        m_events.push_back(event);
+    } else {
+        m_events[m_recordedEventCount % m_capacity] = event;
+    }
+    ++m_recordedEventCount;
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
@@ -0,0 +1,32 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/NetworkListener.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+void NetworkListener::afterRemoval(const std::string& /*id*/) {
+    // Nothing to do
+}
+
+void NetworkListener::beforeRemoval(const Identifiable& /*identifiable*/) {
+    // Nothing to do
+}
+
+void NetworkListener::onCreation(const Identifiable& /*identifiable*/) {
+    // Nothing to do
+}
+
+void NetworkListener::onUpdate(const Identifiable& /*identifiable*/, const std::string& /*attribute*/, unsigned long /*variantIndex*/, double /*oldValue*/, double /*newValue*/) {
+    // Nothing to do
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/NetworkListenerList.hpp>
+
+#include <algorithm>
+
+#include <powsybl/iidm/NetworkListener.hpp>
+#include <powsybl/stdcxx/memory.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+void NetworkListenerList::add(NetworkListener& listener) {
+    m_listeners.emplace_back(std::ref(listener));
+}
+
+bool NetworkListenerList::empty() const {
+    return m_listeners.empty();
+}
+
+void NetworkListenerList::notifyAfterRemoval(const std::string& id) const {
+    for (NetworkListener& listener : m_listeners) {
+        listener.afterRemoval(id);
+    }
+}
+
+void NetworkListenerList::notifyBeforeRemoval(const Identifiable& identifiable) const {
+    for (NetworkListener& listener : m_listeners) {
+        listener.beforeRemoval(identifiable);
+    }
+}
+
+void NetworkListenerList::notifyCreation(const Identifiable& identifiable) const {
+    for (NetworkListener& listener : m_listeners) {
+        listener.onCreation(identifiable);
+    }
+}
+
+void NetworkListenerList::notifyUpdate(const Identifiable& identifiable, const std::string& attribute, unsigned long variantIndex, double oldValue, double newValue) const {
+    for (NetworkListener& listener : m_listeners) {
+        listener.onUpdate(identifiable, attribute, variantIndex, oldValue, newValue);
+    }
+}
+
+void NetworkListenerList::remove(NetworkListener& listener) {
+    m_listeners.erase(std::remove_if(m_listeners.begin(), m_listeners.end(), [&listener](const std::reference_wrapper<NetworkListener>& item) {
+        return stdcxx::areSame(item.get(), listener);
+    }), m_listeners.end());
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
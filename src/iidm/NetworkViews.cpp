@@ -32,6 +32,7 @@ stdcxx::CReference<Bus> BusBreakerView::getBus(const std::string& id) const {
     if (refBus) {
         return stdcxx::cref(refBus);
     }
+    m_network.flushCacheInvalidations();
     return m_network.getBusBreakerViewCache().getBus(id);
 }
 
@@ -40,6 +41,7 @@ stdcxx::Reference<Bus> BusBreakerView::getBus(const std::string& id) {
     if (refBus) {
         return refBus;
     }
+    m_network.flushCacheInvalidations();
     return stdcxx::ref(m_network.getBusBreakerViewCache().getBus(id));
 }
 
@@ -94,10 +96,13 @@ BusView::BusView(Network& network) :
 }
 
 stdcxx::CReference<Bus> BusView::getBus(const std::string& id) const {
+    // The deferred invalidations must be applied before filling the cache, not while filling it
+    m_network.flushCacheInvalidations();
     return m_network.getBusViewCache().getBus(id);
 }
 
 stdcxx::Reference<Bus> BusView::getBus(const std::string& id) {
+    m_network.flushCacheInvalidations();
     return stdcxx::ref(m_network.getBusViewCache().getBus(id));
 }
 
@@ -34,15 +34,19 @@ void NodeBreakerVoltageLevel::addInternalConnection(unsigned long node1, unsigne
     m_graph.addVertexIfNotPresent(node1);
     m_graph.addVertexIfNotPresent(node2);
     m_graph.addEdge(node1, node2, stdcxx::ref<Switch>());
+    ++m_edgeGeneration;
     invalidateCache();
 }
 
-Switch& NodeBreakerVoltageLevel::addSwitch(std::unique_ptr<Switch>&& ptrSwitch, unsigned long node1, unsigned long node2) {
+Switch& NodeBreakerVoltageLevel::addSwitch(NetworkIndex::Ptr<Switch>&& ptrSwitch, unsigned long node1, unsigned long node2) {
     Switch& aSwitch = getNetwork().checkAndAdd(std::move(ptrSwitch));
     m_graph.addVertexIfNotPresent(node1);
     m_graph.addVertexIfNotPresent(node2);
     unsigned long e = m_graph.addEdge(node1, node2, stdcxx::ref(aSwitch));
     m_switches.insert(std::make_pair(aSwitch.getId(), e));
+    ++m_edgeGeneration;
+
+    getNetwork().getListeners().notifyCreation(aSwitch);
 
     return aSwitch;
 }
@@ -214,14 +218,20 @@ node_breaker_voltage_level::BusNamingStrategy& NodeBreakerVoltageLevel::getBusNa
 }
 
 const node_breaker_voltage_level::CalculatedBusBreakerTopology& NodeBreakerVoltageLevel::getCalculatedBusBreakerTopology() const {
+    const_cast<NodeBreakerVoltageLevel&>(*this).flushCacheInvalidation();
+
     return m_variants.get().getCalculatedBusBreakerTopology();
 }
 
 node_breaker_voltage_level::CalculatedBusBreakerTopology& NodeBreakerVoltageLevel::getCalculatedBusBreakerTopology() {
+    flushCacheInvalidation();
+
     return m_variants.get().getCalculatedBusBreakerTopology();
 }
 
 node_breaker_voltage_level::CalculatedBusTopology& NodeBreakerVoltageLevel::getCalculatedBusTopology() {
+    flushCacheInvalidation();
+
     return m_variants.get().getCalculatedBusTopology();
 }
 
@@ -299,6 +309,15 @@ stdcxx::range<Switch> NodeBreakerVoltageLevel::getSwitches() {
     return getNodeBreakerView().getSwitches();
 }
 
+const node_breaker_voltage_level::SwitchStates& NodeBreakerVoltageLevel::getSwitchStates() const {
+    const_cast<NodeBreakerVoltageLevel&>(*this).flushCacheInvalidation();
+
+    node_breaker_voltage_level::SwitchStates& switchStates = m_variants.get().getSwitchStates();
+    switchStates.update(m_graph, m_edgeGeneration);
+
+    return switchStates;
+}
+
 stdcxx::CReference<Terminal> NodeBreakerVoltageLevel::getTerminal(unsigned long node) const {
     return stdcxx::cref<Terminal>(m_graph.getVertexObject(node));
 }
@@ -340,13 +359,10 @@ math::TraverseResult NodeBreakerVoltageLevel::getTraverseResult(TerminalSet& vis
     return math::TraverseResult::TERMINATE_PATH;
 }
 
-void NodeBreakerVoltageLevel::invalidateCache() {
+void NodeBreakerVoltageLevel::invalidateCalculatedTopology() {
     m_variants.get().getCalculatedBusTopology().invalidateCache();
     m_variants.get().getCalculatedBusBreakerTopology().invalidateCache();
-    getNetwork().getBusBreakerView().invalidateCache();
-    getNetwork().getBusView().invalidateCache();
-    getNetwork().getConnectedComponentsManager().invalidate();
-    getNetwork().getSynchronousComponentsManager().invalidate();
+    m_variants.get().getSwitchStates().invalidate();
 }
 
 bool NodeBreakerVoltageLevel::isConnected(const Terminal& terminal) const {
@@ -372,6 +388,7 @@ void NodeBreakerVoltageLevel::removeInternalConnections(unsigned long node1, uns
     for (unsigned long ic : internalConnectionsToBeRemoved) {
         m_graph.removeEdge(ic);
     }
+    ++m_edgeGeneration;
     clean();
     invalidateCache();
 }
@@ -383,6 +400,7 @@ void NodeBreakerVoltageLevel::removeSwitch(const std::string& switchId) {
     }
 
     const auto& aSwitch = m_graph.removeEdge(it->second);
+    ++m_edgeGeneration;
     clean();
 
     m_switches.erase(it);
@@ -391,24 +409,19 @@ void NodeBreakerVoltageLevel::removeSwitch(const std::string& switchId) {
 
 void NodeBreakerVoltageLevel::removeTopology() {
     for (Switch& s : m_graph.getEdgeObjects()) {
-        getNetwork().getIndex().remove(s);
+        getNetwork().remove(s);
     }
     m_graph.removeAllEdges();
     m_switches.clear();
+    ++m_edgeGeneration;
 }
 
-bool NodeBreakerVoltageLevel::traverse(NodeTerminal& terminal, Terminal::TopologyTraverser& traverser) const {
-    TerminalSet traversedTerminals;
-    return traverse(terminal, traverser, traversedTerminals);
-}
-
-bool NodeBreakerVoltageLevel::traverse(NodeTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals) const {
+bool NodeBreakerVoltageLevel::traverse(NodeTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) const {
     const math::TraverseResult& termTraverseResult = getTraverseResult(traversedTerminals, terminal, traverser);
     if (termTraverseResult == math::TraverseResult::TERMINATE_TRAVERSER) {
         return false;
     }
     if (termTraverseResult == math::TraverseResult::CONTINUE) {
-        TerminalSet nextTerminals;
         addNextTerminals(terminal, nextTerminals);
 
         unsigned long node = terminal.getNode();
@@ -429,17 +442,25 @@ bool NodeBreakerVoltageLevel::traverse(NodeTerminal& terminal, Terminal::Topolog
         if (traverseTerminated) {
             return false;
         }
-
-        for (Terminal& nextTerminal : nextTerminals) {
-            if (!nextTerminal.traverse(traverser, traversedTerminals)) {
-                return false;
-            }
-        }
     }
 
     return true;
 }
 
+void NodeBreakerVoltageLevel::updateCalculatedTopology(const Switch& aSwitch) {
+    const unsigned long e = *getEdge(aSwitch.getId(), true);
+    auto& variant = m_variants.get();
+
+    // Only the bus/breaker view is updated around the switch: the bus view is computed again on the next access
+    variant.getCalculatedBusTopology().invalidateCache();
+    variant.getSwitchStates().setOpen(e, aSwitch.isOpen());
+
+    // A retained switch is kept in the bus/breaker view whatever its status, so its buses do not change
+    if (!getSwitchStates().isRetained(e)) {
+        variant.getCalculatedBusBreakerTopology().updateCacheAroundEdge(e);
+    }
+}
+
 }  // namespace iidm
 
 }  // namespace powsybl
@@ -12,6 +12,7 @@
 #include <set>
 #include <string>
 
+#include <powsybl/iidm/NetworkIndex.hpp>
 #include <powsybl/iidm/VariantArray.hpp>
 #include <powsybl/iidm/VoltageLevel.hpp>
 
@@ -62,11 +63,7 @@ public: // VoltageLevel
 
     const TopologyKind& getTopologyKind() const override;
 
-    void invalidateCache() override;
-
-    bool traverse(NodeTerminal& terminal, Terminal::TopologyTraverser& traverser) const;
-
-    bool traverse(NodeTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals) const;
+    bool traverse(NodeTerminal& terminal, Terminal::TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) const;
 
 public:
     NodeBreakerVoltageLevel(const std::string& id, const std::string& name, bool fictitious, const stdcxx::Reference<Substation>& substation,
@@ -76,7 +73,7 @@ public:
 
     void addInternalConnection(unsigned long node1, unsigned long node2);
 
-    Switch& addSwitch(std::unique_ptr<Switch>&& ptrSwitch, unsigned long node1, unsigned long node2);
+    Switch& addSwitch(NetworkIndex::Ptr<Switch>&& ptrSwitch, unsigned long node1, unsigned long node2);
 
     bool isConnected(const Terminal& terminal) const;
 
@@ -95,8 +92,12 @@ protected: // VoltageLevel
     stdcxx::range<Terminal> getTerminals() override;
 
 private:  // VoltageLevel
+    void invalidateCalculatedTopology() override;
+
     void removeTopology() override;
 
+    void updateCalculatedTopology(const Switch& aSwitch) override;
+
 private:
     static math::TraverseResult getTraverseResult(TerminalSet& visitedTerminals, NodeTerminal& terminal, Terminal::TopologyTraverser& traverser);
 
@@ -125,6 +126,8 @@ private:
 
     stdcxx::CReference<Switch> getSwitch(const std::string& switchId) const;
 
+    const node_breaker_voltage_level::SwitchStates& getSwitchStates() const;
+
     stdcxx::CReference<Terminal> getTerminal(unsigned long node) const;
 
     stdcxx::Reference<Terminal> getTerminal(unsigned long node);
@@ -155,6 +158,9 @@ private:
 
     std::map<std::string, unsigned long> m_switches;
 
+    // Incremented each time an edge is added to or removed from the graph
+    unsigned long m_edgeGeneration = 0;
+
     node_breaker_voltage_level::BusNamingStrategy m_busNamingStrategy;
 
     node_breaker_voltage_level::VariantArray m_variants;
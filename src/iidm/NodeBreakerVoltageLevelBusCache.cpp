@@ -7,8 +7,12 @@
 
 #include "NodeBreakerVoltageLevelBusCache.hpp"
 
+#include <algorithm>
+
 #include <boost/range/adaptor/indirected.hpp>
-#include <boost/range/adaptor/map.hpp>
+
+#include <powsybl/AssertionError.hpp>
+#include <powsybl/stdcxx/format.hpp>
 
 namespace powsybl {
 
@@ -16,9 +20,13 @@ namespace iidm {
 
 namespace node_breaker_voltage_level {
 
-BusCache::BusCache(CalculatedBusByNode busByNode, CalculatedBusById busById) :
+BusCache::BusCache(CalculatedBusByNode busByNode, CalculatedBuses buses) :
     m_busByNode(std::move(busByNode)),
-    m_busById(std::move(busById)) {
+    m_buses(std::move(buses)) {
+
+    std::sort(m_buses.begin(), m_buses.end(), [](const std::unique_ptr<CalculatedBus>& bus1, const std::unique_ptr<CalculatedBus>& bus2) {
+        return bus1->getId() < bus2->getId();
+    });
 }
 
 stdcxx::Reference<CalculatedBus> BusCache::getBus(unsigned long node) const {
@@ -26,17 +34,46 @@ stdcxx::Reference<CalculatedBus> BusCache::getBus(unsigned long node) const {
 }
 
 stdcxx::Reference<CalculatedBus> BusCache::getBus(const std::string& id) const {
-    const auto& it = m_busById.find(id);
+    const auto& it = std::lower_bound(m_buses.begin(), m_buses.end(), id, [](const std::unique_ptr<CalculatedBus>& bus, const std::string& busId) {
+        return bus->getId() < busId;
+    });
 
-    return (it == m_busById.end()) ? stdcxx::Reference<CalculatedBus>() : stdcxx::ref<CalculatedBus>(it->second);
+    return (it == m_buses.end() || (*it)->getId() != id) ? stdcxx::Reference<CalculatedBus>() : stdcxx::ref<CalculatedBus>(*it);
+}
+
+const BusCache::CalculatedBusByNode& BusCache::getBusByNode() const {
+    return m_busByNode;
+}
+
+BusCache::CalculatedBusByNode& BusCache::getBusByNode() {
+    return m_busByNode;
 }
 
 stdcxx::const_range<CalculatedBus> BusCache::getBuses() const {
-    return boost::adaptors::values(m_busById) | boost::adaptors::indirected;
+    return m_buses | boost::adaptors::indirected;
 }
 
 stdcxx::range<CalculatedBus> BusCache::getBuses() {
-    return boost::adaptors::values(m_busById) | boost::adaptors::indirected;
+    return m_buses | boost::adaptors::indirected;
+}
+
+void BusCache::replaceBuses(const std::vector<std::reference_wrapper<CalculatedBus> >& oldBuses, CalculatedBuses&& newBuses) {
+    const auto& compare = [](const std::unique_ptr<CalculatedBus>& bus, const std::string& busId) {
+        return bus->getId() < busId;
+    };
+
+    for (const auto& oldBus : oldBuses) {
+        const auto& it = std::lower_bound(m_buses.begin(), m_buses.end(), oldBus.get().getId(), compare);
+        if (it == m_buses.end() || it->get() != &oldBus.get()) {
+            throw AssertionError(stdcxx::format("Bus %1% not found in the cache", oldBus.get().getId()));
+        }
+        m_buses.erase(it);
+    }
+
+    for (auto& newBus : newBuses) {
+        const auto& it = std::lower_bound(m_buses.begin(), m_buses.end(), newBus->getId(), compare);
+        m_buses.insert(it, std::move(newBus));
+    }
 }
 
 }  // namespace node_breaker_voltage_level
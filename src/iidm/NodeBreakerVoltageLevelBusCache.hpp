@@ -9,7 +9,6 @@
 #define POWSYBL_IIDM_NODEBREAKERVOLTAGELEVELBUSCACHE_HPP
 
 #include <functional>
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -28,10 +27,11 @@ class BusCache {
 public:
     using CalculatedBusByNode = std::vector<stdcxx::Reference<CalculatedBus> >;
 
-    using CalculatedBusById = std::map<std::string, std::unique_ptr<CalculatedBus> >;
+    // Buses sorted by id once the cache is built
+    using CalculatedBuses = std::vector<std::unique_ptr<CalculatedBus> >;
 
 public:
-    BusCache(CalculatedBusByNode busByNode, CalculatedBusById busById);
+    BusCache(CalculatedBusByNode busByNode, CalculatedBuses buses);
 
     ~BusCache() noexcept = default;
 
@@ -39,14 +39,24 @@ public:
 
     stdcxx::Reference<CalculatedBus> getBus(const std::string& id) const;
 
+    const CalculatedBusByNode& getBusByNode() const;
+
+    CalculatedBusByNode& getBusByNode();
+
     stdcxx::const_range<CalculatedBus> getBuses() const;
 
     stdcxx::range<CalculatedBus> getBuses();
 
+    /**
+     * Remove the given buses and add the new ones, keeping the buses sorted by id. The removed buses are destroyed: the
+     * nodes mapped to them have to be updated by the caller.
+     */
+    void replaceBuses(const std::vector<std::reference_wrapper<CalculatedBus> >& oldBuses, CalculatedBuses&& newBuses);
+
 private:
     CalculatedBusByNode m_busByNode;
 
-    CalculatedBusById m_busById;
+    CalculatedBuses m_buses;
 };
 
 }  // namespace node_breaker_voltage_level
@@ -7,7 +7,7 @@
 
 #include "NodeBreakerVoltageLevelBusNamingStrategy.hpp"
 
-#include <powsybl/stdcxx/format.hpp>
+#include <algorithm>
 
 #include "NodeBreakerVoltageLevel.hpp"
 
@@ -23,13 +23,13 @@ BusNamingStrategy::BusNamingStrategy(NodeBreakerVoltageLevel& voltageLevel) :
 
 std::string BusNamingStrategy::getId(const std::vector<unsigned long>& nodes) {
     const auto& iter = std::min_element(nodes.cbegin(), nodes.cend());
-    return stdcxx::format("%1%_%2%", m_voltageLevel.getId(), *iter);
+    return m_voltageLevel.getId() + '_' + std::to_string(*iter);
 }
 
 std::string BusNamingStrategy::getName(const std::vector<unsigned long>& nodes) {
     if (!m_voltageLevel.getOptionalName().empty()) {
         const auto& iter = std::min_element(nodes.cbegin(), nodes.cend());
-        return stdcxx::format("%1%_%2%", m_voltageLevel.getOptionalName(), *iter);
+        return m_voltageLevel.getOptionalName() + '_' + std::to_string(*iter);
     }
 
     return "";
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "NodeBreakerVoltageLevelSwitchStates.hpp"
+
+#include <algorithm>
+
+#include <powsybl/iidm/Switch.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+namespace node_breaker_voltage_level {
+
+const SwitchStates::Bitset& SwitchStates::getOpenEdges() const {
+    return m_open;
+}
+
+const SwitchStates::Bitset& SwitchStates::getRetainedEdges() const {
+    return m_retained;
+}
+
+void SwitchStates::invalidate() {
+    m_valid = false;
+}
+
+bool SwitchStates::isOpen(unsigned long e) const {
+    return e < m_open.size() && m_open[e];
+}
+
+bool SwitchStates::isRetained(unsigned long e) const {
+    return e < m_retained.size() && m_retained[e];
+}
+
+void SwitchStates::setOpen(unsigned long e, bool open) {
+    if (m_valid && e < m_open.size()) {
+        m_open[e] = open;
+    }
+}
+
+void SwitchStates::update(const Graph& graph, unsigned long edgeGeneration) {
+    if (m_valid && m_edgeGeneration == edgeGeneration) {
+        return;
+    }
+
+    unsigned long edgeCount = 0;
+    for (unsigned long e : graph.getEdges()) {
+        edgeCount = std::max(edgeCount, e + 1);
+    }
+
+    m_open.clear();
+    m_open.resize(edgeCount);
+    m_retained.clear();
+    m_retained.resize(edgeCount);
+    for (unsigned long e : graph.getEdges()) {
+        const stdcxx::Reference<Switch>& aSwitch = graph.getEdgeObject(e);
+        if (static_cast<bool>(aSwitch)) {
+            m_open[e] = aSwitch.get().isOpen();
+            m_retained[e] = aSwitch.get().isRetained();
+        }
+    }
+
+    m_valid = true;
+    m_edgeGeneration = edgeGeneration;
+}
+
+}  // namespace node_breaker_voltage_level
+
+}  // namespace iidm
+
+}  // namespace powsybl
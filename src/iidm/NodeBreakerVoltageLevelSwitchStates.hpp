@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef POWSYBL_IIDM_NODEBREAKERVOLTAGELEVELSWITCHSTATES_HPP
+#define POWSYBL_IIDM_NODEBREAKERVOLTAGELEVELSWITCHSTATES_HPP
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "NodeBreakerVoltageLevelGraph.hpp"
+
+namespace powsybl {
+
+namespace iidm {
+
+namespace node_breaker_voltage_level {
+
+/**
+ * The open and retained status of the switches of a voltage level for one variant, as bitsets indexed by the edges of
+ * the graph. Internal connections and removed edges are closed and not retained.
+ *
+ * The bitsets are rebuilt from the switches on demand, when the status of a switch changed or when edges were added
+ * or removed since the last update.
+ */
+class SwitchStates {
+public:
+    using Bitset = boost::dynamic_bitset<>;
+
+public:
+    SwitchStates() = default;
+
+    ~SwitchStates() noexcept = default;
+
+    const Bitset& getOpenEdges() const;
+
+    const Bitset& getRetainedEdges() const;
+
+    void invalidate();
+
+    bool isOpen(unsigned long e) const;
+
+    bool isRetained(unsigned long e) const;
+
+    /**
+     * Update the open status of a switch without rebuilding the bitsets. Nothing is done if the bitsets are not up to
+     * date: they will be rebuilt from the switches anyway.
+     */
+    void setOpen(unsigned long e, bool open);
+
+    void update(const Graph& graph, unsigned long edgeGeneration);
+
+private:
+    Bitset m_open;
+
+    Bitset m_retained;
+
+    bool m_valid = false;
+
+    unsigned long m_edgeGeneration = 0;
+};
+
+}  // namespace node_breaker_voltage_level
+
+}  // namespace iidm
+
+}  // namespace powsybl
+
+#endif  // POWSYBL_IIDM_NODEBREAKERVOLTAGELEVELSWITCHSTATES_HPP
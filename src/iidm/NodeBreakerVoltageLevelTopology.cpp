@@ -7,10 +7,13 @@
 
 #include "NodeBreakerVoltageLevelTopology.hpp"
 
+#include <unordered_map>
+
 #include <powsybl/AssertionError.hpp>
 #include <powsybl/PowsyblException.hpp>
 #include <powsybl/iidm/Switch.hpp>
 #include <powsybl/logging/LoggerFactory.hpp>
+#include <powsybl/stdcxx/memory.hpp>
 
 #include "NodeBreakerVoltageLevel.hpp"
 #include "NodeTerminal.hpp"
@@ -30,10 +33,11 @@ CalculatedBusBreakerTopology::CalculatedBusBreakerTopology(NodeBreakerVoltageLev
 
 }
 
-CalculatedBusTopology::SwitchPredicate CalculatedBusBreakerTopology::createSwitchPredicate() const {
-    return [](const stdcxx::Reference<Switch>& aSwitch) {
-        return aSwitch.get().isOpen() || aSwitch.get().isRetained();
-    };
+SwitchStates::Bitset CalculatedBusBreakerTopology::createTerminatingEdges() const {
+    // Retained switches are kept in the bus/breaker view, whatever their status
+    const SwitchStates& switchStates = getVoltageLevel().getSwitchStates();
+
+    return switchStates.getOpenEdges() | switchStates.getRetainedEdges();
 }
 
 stdcxx::Reference<CalculatedBus> CalculatedBusBreakerTopology::getBus1(const std::string& switchId, bool throwException) {
@@ -68,9 +72,8 @@ stdcxx::Reference<CalculatedBus> CalculatedBusBreakerTopology::getBus2(const std
 
 stdcxx::Reference<Switch> CalculatedBusBreakerTopology::getRetainedSwitch(const stdcxx::optional<unsigned long>& e) const {
     if (e) {
-        const auto& aSwitch = getVoltageLevel().getGraph().getEdgeObject(*e);
-        if (aSwitch.get().isRetained()) {
-            return aSwitch;
+        if (getVoltageLevel().getSwitchStates().isRetained(*e)) {
+            return getVoltageLevel().getGraph().getEdgeObject(*e);
         }
     }
 
@@ -88,15 +91,7 @@ stdcxx::CReference<Switch> CalculatedBusBreakerTopology::getSwitch(const std::st
 }
 
 unsigned long CalculatedBusBreakerTopology::getSwitchCount() const {
-    unsigned long switchCount = 0;
-
-    for (const auto& sw : getVoltageLevel().getGraph().getEdgeObjects()) {
-        if (static_cast<bool>(sw) && sw.get().isRetained()) {
-            ++switchCount;
-        }
-    }
-
-    return switchCount;
+    return getVoltageLevel().getSwitchStates().getRetainedEdges().count();
 }
 
 stdcxx::const_range<Switch> CalculatedBusBreakerTopology::getSwitches() const {
@@ -125,10 +120,8 @@ CalculatedBusTopology::CalculatedBusTopology(powsybl::iidm::NodeBreakerVoltageLe
     m_voltageLevel(voltageLevel) {
 }
 
-CalculatedBusTopology::SwitchPredicate CalculatedBusTopology::createSwitchPredicate() const {
-    return [](const stdcxx::Reference<Switch>& aSwitch) {
-        return aSwitch.get().isOpen();
-    };
+SwitchStates::Bitset CalculatedBusTopology::createTerminatingEdges() const {
+    return m_voltageLevel.getSwitchStates().getOpenEdges();
 }
 
 stdcxx::Reference<CalculatedBus> CalculatedBusTopology::getBus(unsigned long node) {
@@ -148,6 +141,47 @@ stdcxx::Reference<CalculatedBus> CalculatedBusTopology::getBus(const std::string
     return bus;
 }
 
+std::vector<long> CalculatedBusTopology::getBusIndexByNode(std::vector<stdcxx::CReference<Bus> >& buses) {
+    updateCache();
+
+    // The cache already maps each node to its bus: number the buses in the order of their first node
+    const BusCache::CalculatedBusByNode& busByNode = m_cache->getBusByNode();
+    std::vector<long> busIndexByNode(busByNode.size(), -1);
+    std::unordered_map<const CalculatedBus*, long> busIndexes;
+
+    buses.clear();
+    for (unsigned long node = 0; node < busByNode.size(); ++node) {
+        const stdcxx::Reference<CalculatedBus>& bus = busByNode[node];
+        if (static_cast<bool>(bus)) {
+            const auto& it = busIndexes.emplace(&bus.get(), static_cast<long>(buses.size()));
+            if (it.second) {
+                buses.emplace_back(stdcxx::cref<Bus>(bus));
+            }
+            busIndexByNode[node] = it.first->second;
+        }
+    }
+
+    return busIndexByNode;
+}
+
+std::vector<long> CalculatedBusTopology::getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses) {
+    // The node of a terminal is its index in the bus cache
+    const std::vector<long>& busIndexByNode = getBusIndexByNode(buses);
+    const auto& graph = m_voltageLevel.getGraph();
+
+    std::vector<long> busIndexByTerminal;
+    terminals.clear();
+    for (unsigned long node : graph.getVertices()) {
+        const stdcxx::Reference<NodeTerminal>& terminal = graph.getVertexObject(node);
+        if (static_cast<bool>(terminal)) {
+            terminals.emplace_back(stdcxx::cref<Terminal>(terminal));
+            busIndexByTerminal.push_back(node < busIndexByNode.size() ? busIndexByNode[node] : -1);
+        }
+    }
+
+    return busIndexByTerminal;
+}
+
 stdcxx::range<CalculatedBus> CalculatedBusTopology::getBuses() {
     updateCache();
 
@@ -253,70 +287,131 @@ bool CalculatedBusTopology::isBusValid(const node_breaker_voltage_level::Graph&
            (branchCount >= 1 && feederCount >= 2);
 }
 
-void CalculatedBusTopology::traverse(unsigned long v, std::vector<bool>& encountered, const CalculatedBusTopology::SwitchPredicate& terminate, BusCache::CalculatedBusById& busById, BusCache::CalculatedBusByNode& busByNode) {
-    if (!encountered[v]) {
-        std::vector<unsigned long> vertices(1, v);
+void CalculatedBusTopology::traverse(unsigned long v, const math::Traverser& traverser, BusCache::CalculatedBuses& buses, BusCache::CalculatedBusByNode& busByNode) {
+    if (!m_encountered[v]) {
+        m_vertices.clear();
+        m_vertices.push_back(v);
 
         const auto& graph = m_voltageLevel.getGraph();
-        graph.traverse(v, [&graph, &terminate, &vertices](unsigned long /*v1*/, unsigned long e, unsigned long v2) {
-            const stdcxx::Reference<Switch> aSwitch = graph.getEdgeObject(e);
-            if (static_cast<bool>(aSwitch) && terminate(aSwitch)) {
-                return math::TraverseResult::TERMINATE_PATH;
-            }
-
-            vertices.push_back(v2);
-            return math::TraverseResult::CONTINUE;
-        }, encountered);
+        graph.traverse(v, traverser, m_encountered);
 
-        std::string busId = m_voltageLevel.getBusNamingStrategy().getId(vertices);
+        unsigned long terminalCount = 0;
+        for (unsigned long vertex : m_vertices) {
+            terminalCount += static_cast<bool>(graph.getVertexObject(vertex)) ? 1 : 0;
+        }
         std::vector<std::reference_wrapper<NodeTerminal> > terminals;
-        terminals.reserve(vertices.size());
-        for (unsigned long vertex : vertices) {
+        terminals.reserve(terminalCount);
+        for (unsigned long vertex : m_vertices) {
             const auto& terminal = graph.getVertexObject(vertex);
             if (static_cast<bool>(terminal)) {
                 terminals.emplace_back(std::ref(terminal.get()));
             }
         }
 
-        if (isBusValid(graph, vertices, terminals)) {
-            std::string busName = m_voltageLevel.getBusNamingStrategy().getName(vertices);
-            std::unique_ptr<CalculatedBus> ptrCalculatedBus = stdcxx::make_unique<CalculatedBus>(busId, busName, m_voltageLevel.isFictitious(), m_voltageLevel, vertices, std::move(terminals));
-            const auto& it = busById.insert(std::make_pair(busId, std::move(ptrCalculatedBus)));
-            const stdcxx::Reference<CalculatedBus>& calculatedBus = stdcxx::ref(*it.first->second);
-
-            for (unsigned long vertex : vertices) {
-                busByNode[vertex] = calculatedBus;
-            }
+        // The nodes of an invalid bus are reset, as they may belong to a bus computed before (see updateCacheAroundEdge)
+        stdcxx::Reference<CalculatedBus> calculatedBus;
+        if (isBusValid(graph, m_vertices, terminals)) {
+            BusNamingStrategy& busNamingStrategy = m_voltageLevel.getBusNamingStrategy();
+            buses.emplace_back(stdcxx::make_unique<CalculatedBus>(busNamingStrategy.getId(m_vertices), busNamingStrategy.getName(m_vertices), m_voltageLevel.isFictitious(), m_voltageLevel, m_vertices, std::move(terminals)));
+            calculatedBus = stdcxx::ref(*buses.back());
+        }
+        for (unsigned long vertex : m_vertices) {
+            busByNode[vertex] = calculatedBus;
         }
     }
 }
 
 void CalculatedBusTopology::updateCache() {
-    updateCache(createSwitchPredicate());
+    if (static_cast<bool>(m_cache)) {
+        return;
+    }
+
+    updateCache(createTerminatingEdges());
 }
 
-void CalculatedBusTopology::updateCache(const SwitchPredicate& predicate) {
+void CalculatedBusTopology::updateCache(const SwitchStates::Bitset& terminatingEdges) {
     if (static_cast<bool>(m_cache)) {
         return;
     }
 
     logging::Logger& logger = logging::LoggerFactory::getLogger<CalculatedBusTopology>();
-    logger.trace(stdcxx::format("Update bus topology of voltage level %1%", m_voltageLevel.getId()));
+    if (logger.isTraceEnabled()) {
+        logger.trace(stdcxx::format("Update bus topology of voltage level %1%", m_voltageLevel.getId()));
+    }
 
     const auto& graph = m_voltageLevel.getGraph();
 
-    BusCache::CalculatedBusById busById;
+    BusCache::CalculatedBuses buses;
     BusCache::CalculatedBusByNode busByNode(graph.getMaxVertex());
 
-    std::vector<bool> encountered(graph.getMaxVertex(), false);
+    // The traverser is shared by all the buses: it collects the vertices of the current bus in m_vertices
+    const math::Traverser traverser = [this, &terminatingEdges](unsigned long /*v1*/, unsigned long e, unsigned long v2) {
+        if (terminatingEdges[e]) {
+            return math::TraverseResult::TERMINATE_PATH;
+        }
+
+        m_vertices.push_back(v2);
+        return math::TraverseResult::CONTINUE;
+    };
+
+    m_encountered.assign(graph.getMaxVertex(), false);
     for (unsigned long e : graph.getEdges()) {
-        traverse(graph.getVertex1(e), encountered, predicate, busById, busByNode);
-        traverse(graph.getVertex2(e), encountered, predicate, busById, busByNode);
+        traverse(graph.getVertex1(e), traverser, buses, busByNode);
+        traverse(graph.getVertex2(e), traverser, buses, busByNode);
+    }
+
+    m_cache = stdcxx::make_unique<BusCache>(std::move(busByNode), std::move(buses));
+
+    if (logger.isTraceEnabled()) {
+        logger.trace(stdcxx::format("Found buses %1%", stdcxx::toString<CalculatedBus>(m_cache->getBuses())));
+    }
+}
+
+void CalculatedBusTopology::updateCacheAroundEdge(unsigned long e) {
+    if (!static_cast<bool>(m_cache)) {
+        return;
+    }
+
+    const auto& graph = m_voltageLevel.getGraph();
+    BusCache::CalculatedBusByNode& busByNode = m_cache->getBusByNode();
+    if (busByNode.size() != graph.getMaxVertex()) {
+        // Nodes have been added since the cache was built
+        invalidateCache();
+        return;
     }
 
-    m_cache = stdcxx::make_unique<BusCache>(std::move(busByNode), std::move(busById));
+    const unsigned long v1 = graph.getVertex1(e);
+    const unsigned long v2 = graph.getVertex2(e);
+
+    // Whether the switch has been opened or closed, the buses of its two nodes are made of the nodes which can be
+    // reached from these two nodes: the buses computed before for these nodes are replaced, the other ones are kept.
+    std::vector<std::reference_wrapper<CalculatedBus> > oldBuses;
+    for (unsigned long v : {v1, v2}) {
+        const stdcxx::Reference<CalculatedBus>& bus = busByNode[v];
+        if (static_cast<bool>(bus) && (oldBuses.empty() || !stdcxx::areSame(oldBuses.front().get(), bus.get()))) {
+            oldBuses.emplace_back(std::ref(bus.get()));
+        }
+    }
 
-    logger.trace(stdcxx::format("Found buses %1%", stdcxx::toString<CalculatedBus>(m_cache->getBuses())));
+    const SwitchStates::Bitset& terminatingEdges = createTerminatingEdges();
+    const math::Traverser traverser = [this, &terminatingEdges](unsigned long /*v1*/, unsigned long e, unsigned long v2) {
+        if (terminatingEdges[e]) {
+            return math::TraverseResult::TERMINATE_PATH;
+        }
+
+        m_vertices.push_back(v2);
+        return math::TraverseResult::CONTINUE;
+    };
+
+    BusCache::CalculatedBuses newBuses;
+    m_encountered.assign(graph.getMaxVertex(), false);
+    traverse(v1, traverser, newBuses, busByNode);
+    traverse(v2, traverser, newBuses, busByNode);
+
+    for (auto& oldBus : oldBuses) {
+        oldBus.get().invalidate();
+    }
+    m_cache->replaceBuses(oldBuses, std::move(newBuses));
 }
 
 }  // namespace node_breaker_voltage_level
@@ -10,6 +10,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <powsybl/stdcxx/optional.hpp>
 #include <powsybl/stdcxx/range.hpp>
@@ -17,11 +18,14 @@
 
 #include "NodeBreakerVoltageLevelBusCache.hpp"
 #include "NodeBreakerVoltageLevelGraph.hpp"
+#include "NodeBreakerVoltageLevelSwitchStates.hpp"
 
 namespace powsybl {
 
 namespace iidm {
 
+class Terminal;
+
 namespace node_breaker_voltage_level {
 
 class graph;
@@ -36,6 +40,10 @@ public:
 
     stdcxx::Reference<CalculatedBus> getBus(const std::string& id, bool throwException);
 
+    std::vector<long> getBusIndexByNode(std::vector<stdcxx::CReference<Bus> >& buses);
+
+    std::vector<long> getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses);
+
     stdcxx::range<CalculatedBus> getBuses();
 
     stdcxx::Reference<Bus> getConnectableBus(unsigned long node);
@@ -44,8 +52,11 @@ public:
 
     void updateCache();
 
-protected:
-    using SwitchPredicate = std::function<bool(const stdcxx::Reference<Switch>& a)>;
+    /**
+     * Update the cache after the status of the switch of the given edge changed: only the buses of the two nodes of
+     * this edge are computed again, the other buses are kept. Nothing is done if the cache is not built yet.
+     */
+    void updateCacheAroundEdge(unsigned long e);
 
 protected:
     const NodeBreakerVoltageLevel& getVoltageLevel() const;
@@ -53,18 +64,26 @@ protected:
     NodeBreakerVoltageLevel& getVoltageLevel();
 
 private:
-    virtual SwitchPredicate createSwitchPredicate() const;
+    /**
+     * Return the edges at which the traversal stops when computing the buses: the open switches.
+     */
+    virtual SwitchStates::Bitset createTerminatingEdges() const;
 
     virtual bool isBusValid(const node_breaker_voltage_level::Graph& graph, const std::vector<unsigned long>& vertices, const std::vector<std::reference_wrapper<NodeTerminal> >& terminals) const;
 
-    void traverse(unsigned long v, std::vector<bool>& encountered, const CalculatedBusTopology::SwitchPredicate& terminate, BusCache::CalculatedBusById& busById, BusCache::CalculatedBusByNode& busByNode);
+    void traverse(unsigned long v, const math::Traverser& traverser, BusCache::CalculatedBuses& buses, BusCache::CalculatedBusByNode& busByNode);
 
-    void updateCache(const SwitchPredicate& predicate);
+    void updateCache(const SwitchStates::Bitset& terminatingEdges);
 
 private:
     NodeBreakerVoltageLevel& m_voltageLevel;
 
     std::unique_ptr<BusCache> m_cache;
+
+    // Buffers reused from one update of the cache to the next
+    std::vector<bool> m_encountered;
+
+    std::vector<unsigned long> m_vertices;
 };
 
 class CalculatedBusBreakerTopology : public CalculatedBusTopology {
@@ -86,7 +105,7 @@ public:
     stdcxx::range<Switch> getSwitches();
 
 private: // CalculatedBusTopology
-    SwitchPredicate createSwitchPredicate() const override;
+    SwitchStates::Bitset createTerminatingEdges() const override;
 
     stdcxx::Reference<Switch> getRetainedSwitch(const stdcxx::optional<unsigned long>& e) const;
 
@@ -40,6 +40,10 @@ CalculatedBusTopology& VariantImpl::getCalculatedBusTopology() {
     return m_calculatedBusTopology;
 }
 
+SwitchStates& VariantImpl::getSwitchStates() const {
+    return m_switchStates;
+}
+
 }  // namespace node_breaker_voltage_level
 
 }  // namespace iidm
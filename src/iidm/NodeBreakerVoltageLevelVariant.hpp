@@ -11,6 +11,7 @@
 #include <powsybl/iidm/Variant.hpp>
 #include <powsybl/iidm/VariantArray.hpp>
 
+#include "NodeBreakerVoltageLevelSwitchStates.hpp"
 #include "NodeBreakerVoltageLevelTopology.hpp"
 
 namespace powsybl {
@@ -34,10 +35,15 @@ public:
 
     CalculatedBusTopology& getCalculatedBusTopology();
 
+    // The switch states are a cache, rebuilt on demand from const accessors too
+    SwitchStates& getSwitchStates() const;
+
 private:
     CalculatedBusBreakerTopology m_calculatedBusBreakerTopology;
 
     CalculatedBusTopology m_calculatedBusTopology;
+
+    mutable SwitchStates m_switchStates;
 };
 
 using VariantArray = iidm::VariantArray<NodeBreakerVoltageLevel, VariantImpl>;
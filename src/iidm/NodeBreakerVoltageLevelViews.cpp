@@ -125,6 +125,10 @@ stdcxx::Reference<Bus> BusViewImpl::getBus(const std::string& busId) {
     return stdcxx::ref<Bus>(m_voltageLevel.getCalculatedBusTopology().getBus(busId, false));
 }
 
+std::vector<long> BusViewImpl::getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses) const {
+    return m_voltageLevel.getCalculatedBusTopology().getBusIndexByTerminal(terminals, buses);
+}
+
 stdcxx::const_range<Bus> BusViewImpl::getBuses() const {
     const auto& calculatedBuses = m_voltageLevel.getCalculatedBusTopology().getBuses();
 
@@ -170,6 +174,10 @@ unsigned long NodeBreakerViewImpl::getBusbarSectionCount() const {
     return m_voltageLevel.getConnectableCount<BusbarSection>();
 }
 
+std::vector<long> NodeBreakerViewImpl::getBusIndexByNode(std::vector<stdcxx::CReference<Bus> >& buses) const {
+    return m_voltageLevel.getCalculatedBusTopology().getBusIndexByNode(buses);
+}
+
 stdcxx::const_range<BusbarSection> NodeBreakerViewImpl::getBusbarSections() const {
     return m_voltageLevel.getConnectables<BusbarSection>();
 }
@@ -331,6 +339,18 @@ void NodeBreakerViewImpl::traverse(stdcxx::const_range<unsigned long>& nodes, co
     m_voltageLevel.getGraph().traverse(nodes, graphTraverser);
 }
 
+void NodeBreakerViewImpl::traverseClosedSwitches(unsigned long node, const TopologyTraverser& traverser) const {
+    const SwitchStates::Bitset& openEdges = m_voltageLevel.getSwitchStates().getOpenEdges();
+    math::Traverser graphTraverser = [this, &openEdges, &traverser](unsigned long v1, unsigned long e, unsigned long v2) {
+        if (openEdges[e]) {
+            return math::TraverseResult::TERMINATE_PATH;
+        }
+        return traverser(v1, m_voltageLevel.getGraph().getEdgeObject(e), v2);
+    };
+
+    m_voltageLevel.getGraph().traverse(node, graphTraverser);
+}
+
 }  // namespace node_breaker_voltage_level
 
 }  // namespace iidm
@@ -24,6 +24,8 @@ public: // NodeBreakerView
 
     unsigned long getBusbarSectionCount() const override;
 
+    std::vector<long> getBusIndexByNode(std::vector<stdcxx::CReference<Bus> >& buses) const override;
+
     stdcxx::const_range<BusbarSection> getBusbarSections() const override;
 
     stdcxx::range<BusbarSection> getBusbarSections() override;
@@ -86,6 +88,8 @@ public: // NodeBreakerView
 
     void traverse(stdcxx::const_range<unsigned long>& nodes, const TopologyTraverser& traverser) const override;
 
+    void traverseClosedSwitches(unsigned long node, const TopologyTraverser& traverser) const override;
+
 public:
     explicit NodeBreakerViewImpl(NodeBreakerVoltageLevel& voltageLevel);
 
@@ -153,6 +157,8 @@ public: // BusView
 
     stdcxx::Reference<Bus> getBus(const std::string& busId) override;
 
+    std::vector<long> getBusIndexByTerminal(std::vector<stdcxx::CReference<Terminal> >& terminals, std::vector<stdcxx::CReference<Bus> >& buses) const override;
+
     stdcxx::const_range<Bus> getBuses() const override;
 
     stdcxx::range<Bus> getBuses() override;
@@ -36,8 +36,8 @@ void NodeTerminal::allocateVariantArrayElement(const std::set<unsigned long>& in
 
     for (auto index : indexes) {
         m_v[index] = m_v[sourceIndex];
-        m_connectedComponentNumber[index] = m_connectedComponentNumber[sourceIndex];
-        m_synchronousComponentNumber[index] = m_synchronousComponentNumber[sourceIndex];
+        m_connectedComponentNumber.set(index, m_connectedComponentNumber.get(sourceIndex));
+        m_synchronousComponentNumber.set(index, m_synchronousComponentNumber.get(sourceIndex));
         m_angle[index] = m_angle[sourceIndex];
     }
 }
@@ -46,8 +46,8 @@ void NodeTerminal::extendVariantArraySize(unsigned long initVariantArraySize, un
     Terminal::extendVariantArraySize(initVariantArraySize, number, sourceIndex);
 
     m_v.resize(m_v.size() + number, m_v[sourceIndex]);
-    m_connectedComponentNumber.resize(m_connectedComponentNumber.size() + number, m_connectedComponentNumber[sourceIndex]);
-    m_synchronousComponentNumber.resize(m_synchronousComponentNumber.size() + number, m_synchronousComponentNumber[sourceIndex]);
+    m_connectedComponentNumber.resize(m_connectedComponentNumber.size() + number, m_connectedComponentNumber.get(sourceIndex));
+    m_synchronousComponentNumber.resize(m_synchronousComponentNumber.size() + number, m_synchronousComponentNumber.get(sourceIndex));
     m_angle.resize(m_angle.size() + number, m_angle[sourceIndex]);
 }
 
@@ -75,8 +75,8 @@ NodeTerminal::BusView& NodeTerminal::getBusView() {
     return m_busView;
 }
 
-const stdcxx::optional<unsigned long>& NodeTerminal::getConnectedComponentNumber() const {
-    return m_connectedComponentNumber[getNetwork().getVariantIndex()];
+stdcxx::optional<unsigned long> NodeTerminal::getConnectedComponentNumber() const {
+    return m_connectedComponentNumber.get(getNetwork().getVariantIndex());
 }
 
 unsigned long NodeTerminal::getNode() const {
@@ -91,8 +91,8 @@ NodeTerminal::NodeBreakerView& NodeTerminal::getNodeBreakerView() {
     return m_nodeBreakerView;
 }
 
-const stdcxx::optional<unsigned long>& NodeTerminal::getSynchronousComponentNumber() const {
-    return m_synchronousComponentNumber[getNetwork().getVariantIndex()];
+stdcxx::optional<unsigned long> NodeTerminal::getSynchronousComponentNumber() const {
+    return m_synchronousComponentNumber.get(getNetwork().getVariantIndex());
 }
 
 double NodeTerminal::getV() const {
@@ -117,13 +117,13 @@ NodeTerminal& NodeTerminal::setAngle(double angle) {
 
 NodeTerminal& NodeTerminal::setConnectedComponentNumber(const stdcxx::optional<unsigned long>& connectedComponentNumber) {
     unsigned long variantIndex = getNetwork().getVariantIndex();
-    m_connectedComponentNumber[variantIndex] = connectedComponentNumber;
+    m_connectedComponentNumber.set(variantIndex, connectedComponentNumber);
     return *this;
 }
 
 NodeTerminal& NodeTerminal::setSynchronousComponentNumber(const stdcxx::optional<unsigned long>& synchronousComponentNumber) {
     unsigned long variantIndex = getNetwork().getVariantIndex();
-    m_synchronousComponentNumber[variantIndex] = synchronousComponentNumber;
+    m_synchronousComponentNumber.set(variantIndex, synchronousComponentNumber);
     return *this;
 }
 
@@ -135,14 +135,9 @@ NodeTerminal& NodeTerminal::setV(double v) {
     return *this;
 }
 
-bool NodeTerminal::traverse(TopologyTraverser& traverser) {
+bool NodeTerminal::traverseVoltageLevel(TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) {
     auto& voltageLevel = dynamic_cast<NodeBreakerVoltageLevel&>(getVoltageLevel());
-    return voltageLevel.traverse(*this, traverser);
-}
-
-bool NodeTerminal::traverse(TopologyTraverser& traverser, TerminalSet& traversedTerminals) {
-    auto& voltageLevel = dynamic_cast<NodeBreakerVoltageLevel&>(getVoltageLevel());
-    return voltageLevel.traverse(*this, traverser, traversedTerminals);
+    return voltageLevel.traverse(*this, traverser, traversedTerminals, nextTerminals);
 }
 
 }  // namespace iidm
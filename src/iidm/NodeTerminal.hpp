@@ -13,6 +13,7 @@
 #include <powsybl/iidm/Terminal.hpp>
 #include <powsybl/stdcxx/optional.hpp>
 
+#include "ComponentNumberArray.hpp"
 #include "NodeTerminalViews.hpp"
 
 namespace powsybl {
@@ -46,10 +47,6 @@ public: // Terminal
 
     bool isConnected() const override;
 
-    bool traverse(TopologyTraverser& traverser) override;
-
-    bool traverse(TopologyTraverser& traverser, TerminalSet& traversedTerminals) override;
-
 public:
     NodeTerminal(VoltageLevel& voltageLevel, unsigned long node);
 
@@ -63,11 +60,11 @@ public:
 
     NodeTerminal& operator=(NodeTerminal&&) = delete;
 
-    const stdcxx::optional<unsigned long>& getConnectedComponentNumber() const;
+    stdcxx::optional<unsigned long> getConnectedComponentNumber() const;
 
     unsigned long getNode() const;
 
-    const stdcxx::optional<unsigned long>& getSynchronousComponentNumber() const;
+    stdcxx::optional<unsigned long> getSynchronousComponentNumber() const;
 
     NodeTerminal& setAngle(double angle);
 
@@ -84,6 +81,9 @@ protected: // MultiVariantObject
 
     void reduceVariantArraySize(unsigned long number) override;
 
+private: // Terminal
+    bool traverseVoltageLevel(TopologyTraverser& traverser, TerminalSet& traversedTerminals, TerminalSet& nextTerminals) override;
+
 private:
     unsigned long m_node;
 
@@ -91,9 +91,9 @@ private:
 
     std::vector<double> m_angle;
 
-    std::vector<stdcxx::optional<unsigned long>> m_connectedComponentNumber;
+    ComponentNumberArray m_connectedComponentNumber;
 
-    std::vector<stdcxx::optional<unsigned long>> m_synchronousComponentNumber;
+    ComponentNumberArray m_synchronousComponentNumber;
 
     node_terminal::NodeBreakerViewImpl m_nodeBreakerView;
 
@@ -14,6 +14,7 @@
 #include <powsybl/iidm/ApparentPowerLimitsAdder.hpp>
 #include <powsybl/iidm/CurrentLimitsAdder.hpp>
 #include <powsybl/iidm/Identifiable.hpp>
+#include <powsybl/iidm/Network.hpp>
 
 namespace powsybl {
 
@@ -40,6 +41,10 @@ stdcxx::range<OperationalLimits> OperationalLimitsHolder::getOperationalLimits()
     return m_operationalLimits | boost::adaptors::map_values | boost::adaptors::indirected;
 }
 
+StringPool& OperationalLimitsHolder::getStringPool() {
+    return m_identifiable.get().getNetwork().getStringPool();
+}
+
 ActivePowerLimitsAdder OperationalLimitsHolder::newActivePowerLimits() {
     return ActivePowerLimitsAdder(*this);
 }
@@ -7,17 +7,43 @@
 
 #include <powsybl/iidm/ReactiveCapabilityCurve.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 
 #include <boost/range/adaptor/map.hpp>
 
-#include <powsybl/AssertionError.hpp>
 #include <powsybl/stdcxx/math.hpp>
 
 namespace powsybl {
 
 namespace iidm {
 
+namespace {
+
+double getQ(const std::vector<ReactiveCapabilityCurve::Point>& points, double p, double (ReactiveCapabilityCurve::Point::*getter)() const) {
+    assert(points.size() >= 2);
+
+    const auto& it = std::lower_bound(points.cbegin(), points.cend(), p, [](const ReactiveCapabilityCurve::Point& point, double value) {
+        return point.getP() < value;
+    });
+    if (it == points.cbegin()) {
+        return ((*it).*getter)();
+    }
+    if (it == points.cend()) {
+        return (points.back().*getter)();
+    }
+    if (stdcxx::isEqual(it->getP(), p)) {
+        return ((*it).*getter)();
+    }
+
+    const auto& p1 = *std::prev(it);
+    const auto& p2 = *it;
+    return (p1.*getter)() + ((p2.*getter)() - (p1.*getter)()) / (p2.getP() - p1.getP()) * (p - p1.getP());
+}
+
+}  // namespace
+
 ReactiveCapabilityCurve::Point::Point(double p, double minQ, double maxQ) :
     m_p(p),
     m_minQ(minQ),
@@ -36,10 +62,13 @@ double ReactiveCapabilityCurve::Point::getP() const {
     return m_p;
 }
 
-ReactiveCapabilityCurve::ReactiveCapabilityCurve(std::map<double, Point>&& points):
-    m_points(std::move(points)) {
+ReactiveCapabilityCurve::ReactiveCapabilityCurve(std::map<double, Point>&& points) {
+    assert(points.size() >= 2);
 
-    assert(m_points.size() >= 2);
+    m_points.reserve(points.size());
+    for (const auto& point : points | boost::adaptors::map_values) {
+        m_points.push_back(point);
+    }
 }
 
 ReactiveLimitsKind ReactiveCapabilityCurve::getKind() const {
@@ -47,65 +76,19 @@ ReactiveLimitsKind ReactiveCapabilityCurve::getKind() const {
 }
 
 double ReactiveCapabilityCurve::getMaxP() const {
-    return m_points.rbegin()->first;
+    return m_points.back().getP();
 }
 
 double ReactiveCapabilityCurve::getMaxQ(double p) const {
-    assert(m_points.size() >= 2);
-
-    const auto& it = m_points.lower_bound(p);
-    if (it != m_points.end() && stdcxx::isEqual(it->first, p)) {
-        return it->second.getMaxQ();
-    }
-
-    const auto& it1 = (it == m_points.cbegin() ? m_points.cend() : std::prev(it));
-    const auto& it2 = it;
-
-    if (it1 == m_points.end() && it2 != m_points.end()) {
-        return it2->second.getMaxQ();
-    }
-    if (it1 != m_points.end() && it2 == m_points.end()) {
-        return it1->second.getMaxQ();
-    }
-    if (it1 != m_points.end() && it2 != m_points.end()) {
-        const auto& p1 = it1->second;
-        const auto& p2 = it2->second;
-
-        return p1.getMaxQ() + (p2.getMaxQ() - p1.getMaxQ()) / (p2.getP() - p1.getP()) * (p - p1.getP());
-    }
-
-    throw AssertionError("Should not happen");
+    return getQ(m_points, p, &Point::getMaxQ);
 }
 
 double ReactiveCapabilityCurve::getMinP() const {
-    return m_points.begin()->first;
+    return m_points.front().getP();
 }
 
 double ReactiveCapabilityCurve::getMinQ(double p) const {
-    assert(m_points.size() >= 2);
-
-    const auto& it = m_points.lower_bound(p);
-    if (it != m_points.end() && stdcxx::isEqual(it->first, p)) {
-        return it->second.getMinQ();
-    }
-
-    const auto& it1 = (it == m_points.cbegin() ? m_points.cend() : std::prev(it));
-    const auto& it2 = it;
-
-    if (it1 == m_points.end() && it2 != m_points.end()) {
-        return it2->second.getMinQ();
-    }
-    if (it1 != m_points.end() && it2 == m_points.end()) {
-        return it1->second.getMinQ();
-    }
-    if (it1 != m_points.end() && it2 != m_points.end()) {
-        const auto& p1 = it1->second;
-        const auto& p2 = it2->second;
-
-        return p1.getMinQ() + (p2.getMinQ() - p1.getMinQ()) / (p2.getP() - p1.getP()) * (p - p1.getP());
-    }
-
-    throw AssertionError("Should not happen");
+    return getQ(m_points, p, &Point::getMinQ);
 }
 
 unsigned long ReactiveCapabilityCurve::getPointCount() const {
@@ -113,11 +96,11 @@ unsigned long ReactiveCapabilityCurve::getPointCount() const {
 }
 
 stdcxx::const_range<ReactiveCapabilityCurve::Point> ReactiveCapabilityCurve::getPoints() const {
-    return m_points | boost::adaptors::map_values;
+    return m_points;
 }
 
 stdcxx::range<ReactiveCapabilityCurve::Point> ReactiveCapabilityCurve::getPoints() {
-    return m_points | boost::adaptors::map_values;
+    return m_points;
 }
 
 }  // namespace iidm
@@ -134,7 +134,9 @@ ShuntCompensator& ShuntCompensator::setRegulatingTerminal(const stdcxx::Referenc
 ShuntCompensator& ShuntCompensator::setSectionCount(unsigned long sectionCount) {
     checkSections(*this, sectionCount, m_model->getMaximumSectionCount());
     unsigned long variantIndex = getNetwork().getVariantIndex();
+    unsigned long oldValue = m_sectionCount[variantIndex];
     m_sectionCount[variantIndex] = sectionCount;
+    notifyUpdate("sectionCount", variantIndex, oldValue, m_sectionCount[variantIndex]);
     return *this;
 }
 
@@ -147,7 +149,10 @@ ShuntCompensator& ShuntCompensator::setTargetDeadband(double targetDeadband) {
 
 ShuntCompensator& ShuntCompensator::setTargetV(double targetV) {
     checkVoltageControl(*this, isVoltageRegulatorOn(), targetV);
-    m_targetV[getNetwork().getVariantIndex()] = targetV;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_targetV[variantIndex];
+    m_targetV[variantIndex] = targetV;
+    notifyUpdate("targetV", variantIndex, oldValue, m_targetV[variantIndex]);
 
     return *this;
 }
@@ -155,7 +160,10 @@ ShuntCompensator& ShuntCompensator::setTargetV(double targetV) {
 ShuntCompensator& ShuntCompensator::setVoltageRegulatorOn(bool voltageRegulatorOn) {
     checkVoltageControl(*this, voltageRegulatorOn, getTargetV());
     checkTargetDeadband(*this, "shunt compensator", voltageRegulatorOn, m_targetDeadband[getNetwork().getVariantIndex()]);
-    m_voltageRegulatorOn[getNetwork().getVariantIndex()] = voltageRegulatorOn;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    bool oldValue = m_voltageRegulatorOn[variantIndex];
+    m_voltageRegulatorOn[variantIndex] = voltageRegulatorOn;
+    notifyUpdate("voltageRegulatorOn", variantIndex, oldValue, m_voltageRegulatorOn[variantIndex]);
 
     return *this;
 }
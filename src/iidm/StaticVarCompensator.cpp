@@ -107,7 +107,10 @@ StaticVarCompensator& StaticVarCompensator::setBmin(double bMin) {
 
 StaticVarCompensator& StaticVarCompensator::setReactivePowerSetpoint(double reactivePowerSetpoint) {
     checkSvcRegulator(*this, getVoltageSetpoint(), reactivePowerSetpoint, getRegulationMode());
-    m_reactivePowerSetpoint[getNetwork().getVariantIndex()] = reactivePowerSetpoint;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_reactivePowerSetpoint[variantIndex];
+    m_reactivePowerSetpoint[variantIndex] = reactivePowerSetpoint;
+    notifyUpdate("reactivePowerSetpoint", variantIndex, oldValue, m_reactivePowerSetpoint[variantIndex]);
 
     return *this;
 }
@@ -127,7 +130,10 @@ StaticVarCompensator& StaticVarCompensator::setRegulationMode(const RegulationMo
 
 StaticVarCompensator& StaticVarCompensator::setVoltageSetpoint(double voltageSetpoint) {
     checkSvcRegulator(*this, voltageSetpoint, getReactivePowerSetpoint(), getRegulationMode());
-    m_voltageSetpoint[getNetwork().getVariantIndex()] = voltageSetpoint;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_voltageSetpoint[variantIndex];
+    m_voltageSetpoint[variantIndex] = voltageSetpoint;
+    notifyUpdate("voltageSetpoint", variantIndex, oldValue, m_voltageSetpoint[variantIndex]);
 
     return *this;
 }
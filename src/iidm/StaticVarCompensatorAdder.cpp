@@ -29,13 +29,15 @@ StaticVarCompensator& StaticVarCompensatorAdder::add() {
 
     std::unique_ptr<Terminal> ptrTerminal = checkAndGetTerminal();
     Terminal& regulatingTerminal = m_regulatingTerminal ? m_regulatingTerminal.get() : *ptrTerminal;
-    std::unique_ptr<StaticVarCompensator> ptrSvc = stdcxx::make_unique<StaticVarCompensator>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(), m_bMin, m_bMax, m_voltageSetpoint,
+    NetworkIndex::Ptr<StaticVarCompensator> ptrSvc = getNetwork().createIdentifiable<StaticVarCompensator>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(), m_bMin, m_bMax, m_voltageSetpoint,
         m_reactivePowerSetpoint, *m_regulationMode, regulatingTerminal);
     auto& svc = getNetwork().checkAndAdd<StaticVarCompensator>(std::move(ptrSvc));
 
     Terminal& terminal = svc.addTerminal(std::move(ptrTerminal));
     getVoltageLevel().attach(terminal, false);
 
+    getNetwork().getListeners().notifyCreation(svc);
+
     return svc;
 }
 
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/StringPool.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+const std::string& StringPool::getEmptyString() {
+    static std::string s_emptyString;
+
+    return s_emptyString;
+}
+
+const std::string& StringPool::intern(const std::string& value) {
+    if (value.empty()) {
+        return getEmptyString();
+    }
+    return *m_strings.insert(value).first;
+}
+
+unsigned long StringPool::size() const {
+    return m_strings.size();
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
@@ -20,9 +20,11 @@ SubstationAdder::SubstationAdder(Network& network) :
 }
 
 Substation& SubstationAdder::add() {
-    std::unique_ptr<Substation> ptrSubstation = stdcxx::make_unique<Substation>(m_network, checkAndGetUniqueId(), getName(), isFictitious(), m_country, m_tso, m_geographicalTags);
+    NetworkIndex::Ptr<Substation> ptrSubstation = m_network.createIdentifiable<Substation>(m_network, checkAndGetUniqueId(), getName(), isFictitious(), m_country, m_tso, m_geographicalTags);
     auto& substation = m_network.checkAndAdd<Substation>(std::move(ptrSubstation));
 
+    m_network.getListeners().notifyCreation(substation);
+
     return substation;
 }
 
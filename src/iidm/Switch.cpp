@@ -97,7 +97,8 @@ Switch& Switch::setOpen(bool open) {
     bool oldValue = m_open[index];
     if (oldValue != open) {
         m_open[index] = open;
-        m_voltageLevel.get().invalidateCache();
+        m_voltageLevel.get().invalidateCache(*this);
+        notifyUpdate("open", index, oldValue, open);
     }
 
     return *this;
@@ -113,6 +114,7 @@ Switch& Switch::setRetained(bool retained) {
     if (oldValue != retained) {
         m_retained[index] = retained;
         m_voltageLevel.get().invalidateCache();
+        notifyUpdate("retained", index, oldValue, retained);
     }
 
     return *this;
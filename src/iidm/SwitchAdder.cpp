@@ -30,7 +30,7 @@ Switch& SwitchAdder::add() {
 
     auto& voltageLevel = dynamic_cast<NodeBreakerVoltageLevel&>(getVoltageLevel());
 
-    std::unique_ptr<Switch> ptrSwitch = stdcxx::make_unique<Switch>(voltageLevel, checkAndGetUniqueId(), getName(), isFictitious(), *m_kind, isOpen(), m_retained);
+    NetworkIndex::Ptr<Switch> ptrSwitch = getNetwork().createIdentifiable<Switch>(voltageLevel, checkAndGetUniqueId(), getName(), isFictitious(), *m_kind, isOpen(), m_retained);
     Switch& aSwitch = voltageLevel.addSwitch(std::move(ptrSwitch), *m_node1, *m_node2);
 
     return aSwitch;
@@ -70,7 +70,7 @@ Switch& SwitchAdder::add() {
 
     auto& voltageLevel = dynamic_cast<BusBreakerVoltageLevel&>(getVoltageLevel());
 
-    std::unique_ptr<Switch> ptrSwitch = stdcxx::make_unique<Switch>(voltageLevel, checkAndGetUniqueId(), getName(), isFictitious(), SwitchKind::BREAKER, isOpen(), true);
+    NetworkIndex::Ptr<Switch> ptrSwitch = getNetwork().createIdentifiable<Switch>(voltageLevel, checkAndGetUniqueId(), getName(), isFictitious(), SwitchKind::BREAKER, isOpen(), true);
     Switch& aSwitch = voltageLevel.addSwitch(std::move(ptrSwitch), m_bus1, m_bus2);
 
     return aSwitch;
@@ -8,8 +8,10 @@
 #include <powsybl/iidm/Terminal.hpp>
 
 #include <cmath>
+#include <functional>
 
 #include <powsybl/iidm/Connectable.hpp>
+#include <powsybl/iidm/Network.hpp>
 #include <powsybl/iidm/ValidationException.hpp>
 #include <powsybl/iidm/VariantManager.hpp>
 #include <powsybl/iidm/VoltageLevel.hpp>
@@ -38,7 +40,11 @@ void Terminal::allocateVariantArrayElement(const std::set<unsigned long>& indexe
 }
 
 bool Terminal::connect() {
-    return m_voltageLevel.connect(*this);
+    bool connected = m_voltageLevel.connect(*this);
+    if (connected) {
+        notifyConnectionUpdate(true);
+    }
+    return connected;
 }
 
 void Terminal::deleteVariantArrayElement(unsigned long /*index*/) {
@@ -46,7 +52,11 @@ void Terminal::deleteVariantArrayElement(unsigned long /*index*/) {
 }
 
 bool Terminal::disconnect() {
-    return m_voltageLevel.disconnect(*this);
+    bool disconnected = m_voltageLevel.disconnect(*this);
+    if (disconnected) {
+        notifyConnectionUpdate(false);
+    }
+    return disconnected;
 }
 
 void Terminal::extendVariantArraySize(unsigned long /*initVariantArraySize*/, unsigned long number, unsigned long sourceIndex) {
@@ -94,6 +104,13 @@ VoltageLevel& Terminal::getVoltageLevel() {
     return m_voltageLevel;
 }
 
+void Terminal::notifyConnectionUpdate(bool connected) {
+    const NetworkListenerList& listeners = getNetwork().getListeners();
+    if (!listeners.empty() && static_cast<bool>(m_connectable)) {
+        listeners.notifyUpdate(m_connectable.get(), "connected", getNetwork().getVariantIndex(), !connected, connected);
+    }
+}
+
 void Terminal::reduceVariantArraySize(unsigned long number) {
     m_p.resize(m_p.size() - number);
     m_q.resize(m_q.size() - number);
@@ -132,6 +149,32 @@ Terminal& Terminal::setQ(double q) {
     return *this;
 }
 
+bool Terminal::traverse(TopologyTraverser& traverser) {
+    TerminalSet traversedTerminals;
+    return traverse(traverser, traversedTerminals);
+}
+
+bool Terminal::traverse(TopologyTraverser& traverser, TerminalSet& traversedTerminals) {
+    // Depth-first traversal driven by a stack of terminals, so that crossing a branch does not recurse and the depth
+    // of the network does not matter
+    std::vector<std::reference_wrapper<Terminal> > terminals(1, std::ref(*this));
+    TerminalSet nextTerminals;
+    while (!terminals.empty()) {
+        Terminal& terminal = terminals.back().get();
+        terminals.pop_back();
+
+        nextTerminals.clear();
+        if (!terminal.traverseVoltageLevel(traverser, traversedTerminals, nextTerminals)) {
+            return false;
+        }
+
+        // Push the next terminals in reverse order so that they are traversed in the order of a recursive traversal
+        terminals.insert(terminals.end(), nextTerminals.rbegin(), nextTerminals.rend());
+    }
+
+    return true;
+}
+
 std::unique_ptr<Terminal> createBusTerminal(VoltageLevel& voltageLevel, const std::string& connectableBusId, bool connected) {
     return stdcxx::make_unique<BusTerminal>(voltageLevel, connectableBusId, connected);
 }
@@ -77,7 +77,7 @@ ThreeWindingsTransformer& ThreeWindingsTransformerAdder::add() {
         logger.info(stdcxx::format("RatedU0 is not set. Fixed to leg1 ratedU: %1%", leg1.getRatedU()));
     }
 
-    std::unique_ptr<ThreeWindingsTransformer> ptrTransformer = stdcxx::make_unique<ThreeWindingsTransformer>(checkAndGetUniqueId(), getName(), isFictitious(), std::move(leg1), std::move(leg2), std::move(leg3), m_ratedU0);
+    NetworkIndex::Ptr<ThreeWindingsTransformer> ptrTransformer = getNetwork().createIdentifiable<ThreeWindingsTransformer>(checkAndGetUniqueId(), getName(), isFictitious(), std::move(leg1), std::move(leg2), std::move(leg3), m_ratedU0);
     auto& transformer = getNetwork().checkAndAdd<ThreeWindingsTransformer>(std::move(ptrTransformer));
 
     Terminal& terminal1 = transformer.addTerminal(std::move(ptrTerminal1));
@@ -88,6 +88,8 @@ ThreeWindingsTransformer& ThreeWindingsTransformerAdder::add() {
     voltageLevel2.attach(terminal2, false);
     voltageLevel3.attach(terminal3, false);
 
+    getNetwork().getListeners().notifyCreation(transformer);
+
     return transformer;
 }
 
@@ -43,7 +43,7 @@ TieLine& TieLineAdder::add() {
     voltageLevel1.attach(*ptrTerminal1, true);
     voltageLevel2.attach(*ptrTerminal2, true);
 
-    std::unique_ptr<TieLine> ptrTieLine = stdcxx::make_unique<TieLine>(checkAndGetUniqueId(), getName(), isFictitious(), m_ucteXnodeCode, std::move(half1), std::move(half2));
+    NetworkIndex::Ptr<TieLine> ptrTieLine = m_network.createIdentifiable<TieLine>(checkAndGetUniqueId(), getName(), isFictitious(), m_ucteXnodeCode, std::move(half1), std::move(half2));
     auto& tieLine = m_network.checkAndAdd<TieLine>(std::move(ptrTieLine));
 
     Terminal& terminal1 = tieLine.addTerminal(std::move(ptrTerminal1));
@@ -51,6 +51,8 @@ TieLine& TieLineAdder::add() {
     voltageLevel1.attach(terminal1, false);
     voltageLevel2.attach(terminal2, false);
 
+    m_network.getListeners().notifyCreation(tieLine);
+
     return tieLine;
 }
 
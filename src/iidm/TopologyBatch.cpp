@@ -0,0 +1,42 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/TopologyBatch.hpp>
+
+#include <powsybl/PowsyblException.hpp>
+#include <powsybl/iidm/Network.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+TopologyBatch::TopologyBatch(Network& network) :
+    m_network(network) {
+    network.beginTopologyBatch();
+}
+
+TopologyBatch::~TopologyBatch() noexcept {
+    if (!m_committed) {
+        m_network.get().commitTopologyBatch();
+    }
+}
+
+void TopologyBatch::commit() {
+    if (m_committed) {
+        throw PowsyblException("Topology batch already committed");
+    }
+    m_committed = true;
+    m_network.get().commitTopologyBatch();
+}
+
+bool TopologyBatch::isCommitted() const {
+    return m_committed;
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
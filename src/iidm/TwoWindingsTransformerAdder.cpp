@@ -57,7 +57,7 @@ TwoWindingsTransformer& TwoWindingsTransformerAdder::add() {
     voltageLevel1.attach(*ptrTerminal1, true);
     voltageLevel2.attach(*ptrTerminal2, true);
 
-    std::unique_ptr<TwoWindingsTransformer> ptrTransformer = stdcxx::make_unique<TwoWindingsTransformer>(checkAndGetUniqueId(), getName(), isFictitious(), m_substation, m_r, m_x, m_g, m_b, m_ratedU1, m_ratedU2, m_ratedS);
+    NetworkIndex::Ptr<TwoWindingsTransformer> ptrTransformer = getNetwork().createIdentifiable<TwoWindingsTransformer>(checkAndGetUniqueId(), getName(), isFictitious(), m_substation, m_r, m_x, m_g, m_b, m_ratedU1, m_ratedU2, m_ratedS);
     auto& transformer = getNetwork().checkAndAdd<TwoWindingsTransformer>(std::move(ptrTransformer));
 
     Terminal& terminal1 = transformer.addTerminal(std::move(ptrTerminal1));
@@ -65,6 +65,8 @@ TwoWindingsTransformer& TwoWindingsTransformerAdder::add() {
     voltageLevel1.attach(terminal1, false);
     voltageLevel2.attach(terminal2, false);
 
+    getNetwork().getListeners().notifyCreation(transformer);
+
     return transformer;
 }
 
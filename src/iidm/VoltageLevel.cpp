@@ -73,6 +73,20 @@ void VoltageLevel::addNextTerminals(Terminal& otherTerminal, TerminalSet& nextTe
     }
 }
 
+void VoltageLevel::flushCacheInvalidation() {
+    if (m_pendingInvalidations.empty()) {
+        return;
+    }
+
+    const auto& it = m_pendingInvalidations.find(getNetwork().getVariantIndex());
+    if (it != m_pendingInvalidations.end()) {
+        m_pendingInvalidations.erase(it);
+        invalidateCalculatedTopology();
+        incrementTopologyGeneration();
+        getNetwork().invalidateTopologyCache();
+    }
+}
+
 unsigned long VoltageLevel::getBatteryCount() const {
     return getConnectableCount<Battery>();
 }
@@ -227,6 +241,10 @@ stdcxx::range<TwoWindingsTransformer> VoltageLevel::getTwoWindingsTransformers()
     return getConnectables<TwoWindingsTransformer>();
 }
 
+unsigned long VoltageLevel::getTopologyGeneration() const {
+    return m_topologyGeneration;
+}
+
 const IdentifiableType& VoltageLevel::getType() const {
     static IdentifiableType s_type = IdentifiableType::VOLTAGE_LEVEL;
     return s_type;
@@ -250,6 +268,39 @@ stdcxx::range<VscConverterStation> VoltageLevel::getVscConverterStations() {
     return getConnectables<VscConverterStation>();
 }
 
+void VoltageLevel::incrementTopologyGeneration() {
+    ++m_topologyGeneration;
+    getNetwork().incrementTopologyGeneration();
+}
+
+void VoltageLevel::invalidateCache() {
+    Network& network = getNetwork();
+    if (network.isInTopologyBatch()) {
+        // Nothing is invalidated yet: the calculated topology stays consistent until it is read or the batch commits
+        if (m_pendingInvalidations.insert(network.getVariantIndex()).second) {
+            network.deferCacheInvalidation(*this);
+        }
+        return;
+    }
+
+    invalidateCalculatedTopology();
+    incrementTopologyGeneration();
+    network.invalidateTopologyCache();
+}
+
+void VoltageLevel::invalidateCache(const Switch& aSwitch) {
+    Network& network = getNetwork();
+    if (network.isInTopologyBatch()) {
+        // The invalidation is deferred: there is no point in updating the calculated topology switch by switch
+        invalidateCache();
+        return;
+    }
+
+    updateCalculatedTopology(aSwitch);
+    incrementTopologyGeneration();
+    network.invalidateTopologyCache();
+}
+
 BatteryAdder VoltageLevel::newBattery() {
     return BatteryAdder(*this);
 }
@@ -297,7 +348,7 @@ void VoltageLevel::remove() {
         // Remove this voltage level from the network
         m_substation.get().remove(*this);
     }
-    getNetwork().getIndex().remove(*this);
+    getNetwork().remove(*this);
 }
 
 VoltageLevel& VoltageLevel::setHighVoltageLimit(double highVoltageLimit) {
@@ -321,6 +372,10 @@ VoltageLevel& VoltageLevel::setNominalV(double nominalV) {
     return *this;
 }
 
+void VoltageLevel::updateCalculatedTopology(const Switch& /*aSwitch*/) {
+    invalidateCalculatedTopology();
+}
+
 void VoltageLevel::visitEquipments(TopologyVisitor& visitor) const {
     TopologyVisitor::visitEquipments(getTerminals(), visitor);
 }
@@ -37,12 +37,12 @@ VoltageLevel& VoltageLevelAdder::add() {
     switch (*m_topologyKind) {
         case TopologyKind::NODE_BREAKER:
             voltageLevel = stdcxx::ref<VoltageLevel>(getNetwork().checkAndAdd<NodeBreakerVoltageLevel>(
-                stdcxx::make_unique<NodeBreakerVoltageLevel>(checkAndGetUniqueId(), getName(), isFictitious(), m_substation, m_network, m_nominalV, m_lowVoltageLimit, m_highVoltageLimit)));
+                getNetwork().createIdentifiable<NodeBreakerVoltageLevel>(checkAndGetUniqueId(), getName(), isFictitious(), m_substation, m_network, m_nominalV, m_lowVoltageLimit, m_highVoltageLimit)));
             break;
 
         case TopologyKind::BUS_BREAKER:
             voltageLevel = stdcxx::ref<VoltageLevel>(getNetwork().checkAndAdd<BusBreakerVoltageLevel>(
-                stdcxx::make_unique<BusBreakerVoltageLevel>(checkAndGetUniqueId(), getName(), isFictitious(), m_substation, m_network, m_nominalV, m_lowVoltageLimit, m_highVoltageLimit)));
+                getNetwork().createIdentifiable<BusBreakerVoltageLevel>(checkAndGetUniqueId(), getName(), isFictitious(), m_substation, m_network, m_nominalV, m_lowVoltageLimit, m_highVoltageLimit)));
             break;
 
         default:
@@ -52,6 +52,8 @@ VoltageLevel& VoltageLevelAdder::add() {
     if (static_cast<bool>(m_substation)) {
         m_substation.get().addVoltageLevel(voltageLevel);
     }
+    getNetwork().getListeners().notifyCreation(voltageLevel.get());
+
     return voltageLevel;
 }
 
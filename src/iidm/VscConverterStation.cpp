@@ -86,7 +86,10 @@ VscConverterStation& VscConverterStation::setLossFactor(double lossFactor) {
 
 VscConverterStation& VscConverterStation::setReactivePowerSetpoint(double reactivePowerSetpoint) {
     checkVoltageControl(*this, isVoltageRegulatorOn(), getVoltageSetpoint(), reactivePowerSetpoint);
-    m_reactivePowerSetpoint[getNetwork().getVariantIndex()] = reactivePowerSetpoint;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_reactivePowerSetpoint[variantIndex];
+    m_reactivePowerSetpoint[variantIndex] = reactivePowerSetpoint;
+    notifyUpdate("reactivePowerSetpoint", variantIndex, oldValue, m_reactivePowerSetpoint[variantIndex]);
     return *this;
 }
 
@@ -98,13 +101,19 @@ VscConverterStation& VscConverterStation::setRegulatingTerminal(const stdcxx::Re
 
 VscConverterStation& VscConverterStation::setVoltageRegulatorOn(bool voltageRegulatorOn) {
     checkVoltageControl(*this, voltageRegulatorOn, getVoltageSetpoint(), getReactivePowerSetpoint());
-    m_voltageRegulatorOn[getNetwork().getVariantIndex()] = voltageRegulatorOn;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    bool oldValue = m_voltageRegulatorOn[variantIndex];
+    m_voltageRegulatorOn[variantIndex] = voltageRegulatorOn;
+    notifyUpdate("voltageRegulatorOn", variantIndex, oldValue, m_voltageRegulatorOn[variantIndex]);
     return *this;
 }
 
 VscConverterStation& VscConverterStation::setVoltageSetpoint(double voltageSetpoint) {
     checkVoltageControl(*this, isVoltageRegulatorOn(), voltageSetpoint, getReactivePowerSetpoint());
-    m_voltageSetpoint[getNetwork().getVariantIndex()] = voltageSetpoint;
+    unsigned long variantIndex = getNetwork().getVariantIndex();
+    double oldValue = m_voltageSetpoint[variantIndex];
+    m_voltageSetpoint[variantIndex] = voltageSetpoint;
+    notifyUpdate("voltageSetpoint", variantIndex, oldValue, m_voltageSetpoint[variantIndex]);
     return *this;
 }
 }  // namespace iidm
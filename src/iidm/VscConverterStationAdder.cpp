@@ -26,12 +26,14 @@ VscConverterStation& VscConverterStationAdder::add() {
     validate();
 
     Terminal& regulatingTerminal = m_regulatingTerminal ? m_regulatingTerminal.get() : *terminalPtr;
-    std::unique_ptr<VscConverterStation> ptrVsc = stdcxx::make_unique<VscConverterStation>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(), getLossFactor(), *m_voltageRegulatorOn, m_reactivePowerSetpoint, m_voltageSetpoint, regulatingTerminal);
+    NetworkIndex::Ptr<VscConverterStation> ptrVsc = getNetwork().createIdentifiable<VscConverterStation>(getNetwork(), checkAndGetUniqueId(), getName(), isFictitious(), getLossFactor(), *m_voltageRegulatorOn, m_reactivePowerSetpoint, m_voltageSetpoint, regulatingTerminal);
     auto& vsc = getNetwork().checkAndAdd<VscConverterStation>(std::move(ptrVsc));
 
     Terminal& terminal = vsc.addTerminal(std::move(terminalPtr));
     getVoltageLevel().attach(terminal, false);
 
+    getNetwork().getListeners().notifyCreation(vsc);
+
     return vsc;
 }
 
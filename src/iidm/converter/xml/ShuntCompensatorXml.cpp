@@ -13,6 +13,7 @@
 #include <powsybl/iidm/ShuntCompensatorNonLinearModel.hpp>
 #include <powsybl/iidm/converter/Constants.hpp>
 #include <powsybl/iidm/converter/xml/TerminalRefXml.hpp>
+#include <powsybl/stdcxx/Properties.hpp>
 
 namespace powsybl {
 
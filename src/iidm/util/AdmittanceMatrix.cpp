@@ -0,0 +1,264 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/util/AdmittanceMatrix.hpp>
+
+#include <algorithm>
+
+#include <powsybl/PowsyblException.hpp>
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Line.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/PhaseTapChanger.hpp>
+#include <powsybl/iidm/RatioTapChanger.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/iidm/ThreeWindingsTransformer.hpp>
+#include <powsybl/iidm/TwoWindingsTransformer.hpp>
+#include <powsybl/stdcxx/format.hpp>
+#include <powsybl/stdcxx/math.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+namespace {
+
+struct TransformerParameters {
+    double r;
+
+    double x;
+
+    double g;
+
+    double b;
+
+    double rho;
+
+    double alpha;
+};
+
+TransformerParameters getTransformerParameters(const RatioTapChangerHolder& rtcHolder, const PhaseTapChangerHolder& ptcHolder,
+                                               double r, double x, double g, double b, double rho) {
+    TransformerParameters parameters{r, x, g, b, rho, 0.0};
+    if (rtcHolder.hasRatioTapChanger()) {
+        const auto& step = rtcHolder.getRatioTapChanger().getCurrentStep();
+        parameters.r *= 1 + step.getR() / 100;
+        parameters.x *= 1 + step.getX() / 100;
+        parameters.g *= 1 + step.getG() / 100;
+        parameters.b *= 1 + step.getB() / 100;
+        parameters.rho *= step.getRho();
+    }
+    if (ptcHolder.hasPhaseTapChanger()) {
+        const auto& step = ptcHolder.getPhaseTapChanger().getCurrentStep();
+        parameters.r *= 1 + step.getR() / 100;
+        parameters.x *= 1 + step.getX() / 100;
+        parameters.g *= 1 + step.getG() / 100;
+        parameters.b *= 1 + step.getB() / 100;
+        parameters.rho *= step.getRho();
+        parameters.alpha = step.getAlpha() * stdcxx::toRadians;
+    }
+    return parameters;
+}
+
+}  // namespace
+
+AdmittanceMatrix::AdmittanceMatrix(const Network& network) {
+    for (const Bus& bus : network.getBusView().getBuses()) {
+        m_busIndexes.emplace(bus.getId(), m_busIndexes.size());
+    }
+    m_size = m_busIndexes.size() + network.getThreeWindingsTransformerCount();
+
+    const unsigned long branchCount = network.getLineCount() + network.getTwoWindingsTransformerCount() + 3 * network.getThreeWindingsTransformerCount();
+    m_parameters.resize(branchCount);
+    m_admittances.resize(branchCount);
+    m_branchBuses.reserve(branchCount);
+
+    for (const Line& line : network.getLines()) {
+        unsigned long index = m_branchBuses.size();
+        m_parameters.r[index] = line.getR();
+        m_parameters.x[index] = line.getX();
+        m_parameters.g1[index] = line.getG1();
+        m_parameters.b1[index] = line.getB1();
+        m_parameters.g2[index] = line.getG2();
+        m_parameters.b2[index] = line.getB2();
+        addBranch(getBusIndex(line.getTerminal1()), getBusIndex(line.getTerminal2()));
+    }
+
+    m_firstTransformer = m_branchBuses.size();
+    for (const TwoWindingsTransformer& twt : network.getTwoWindingsTransformers()) {
+        m_twoWindingsTransformers.emplace_back(std::cref(twt));
+        addBranch(getBusIndex(twt.getTerminal1()), getBusIndex(twt.getTerminal2()));
+    }
+
+    long starBus = static_cast<long>(m_busIndexes.size());
+    for (const ThreeWindingsTransformer& twt : network.getThreeWindingsTransformers()) {
+        for (const auto& leg : twt.getLegs()) {
+            m_legs.emplace_back(std::cref(leg), twt.getRatedU0());
+            addBranch(getBusIndex(leg.getTerminal()), starBus);
+        }
+        ++starBus;
+    }
+
+    buildStructure();
+
+    // The admittances of the lines do not depend on the tap positions: they are computed once
+    LinkData::calculateBranchAdmittances(m_parameters, 0, m_firstTransformer, m_admittances);
+    updateTapPositions();
+}
+
+void AdmittanceMatrix::addBranch(long bus1, long bus2) {
+    if (bus1 < 0 || bus2 < 0) {
+        // branches open on at least one side are ignored
+        bus1 = -1;
+        bus2 = -1;
+    }
+    m_branchBuses.push_back({{bus1, bus2}});
+}
+
+void AdmittanceMatrix::buildStructure() {
+    std::vector<std::pair<unsigned long, unsigned long>> entries;
+    entries.reserve(m_size + 2 * m_branchBuses.size());
+    for (unsigned long i = 0; i < m_size; ++i) {
+        entries.emplace_back(i, i);
+    }
+    for (const auto& buses : m_branchBuses) {
+        if (buses[0] >= 0) {
+            entries.emplace_back(buses[0], buses[1]);
+            entries.emplace_back(buses[1], buses[0]);
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    m_rowOffsets.assign(m_size + 1, 0);
+    m_columnIndices.resize(entries.size());
+    for (unsigned long i = 0; i < entries.size(); ++i) {
+        ++m_rowOffsets[entries[i].first + 1];
+        m_columnIndices[i] = entries[i].second;
+    }
+    for (unsigned long i = 0; i < m_size; ++i) {
+        m_rowOffsets[i + 1] += m_rowOffsets[i];
+    }
+    m_values.resize(entries.size());
+
+    const auto& findPosition = [this](unsigned long row, unsigned long column) {
+        auto first = m_columnIndices.begin() + m_rowOffsets[row];
+        auto last = m_columnIndices.begin() + m_rowOffsets[row + 1];
+        return static_cast<unsigned long>(std::lower_bound(first, last, column) - m_columnIndices.begin());
+    };
+
+    m_branchPositions.resize(m_branchBuses.size());
+    for (unsigned long i = 0; i < m_branchBuses.size(); ++i) {
+        const auto& buses = m_branchBuses[i];
+        if (buses[0] >= 0) {
+            unsigned long bus1 = buses[0];
+            unsigned long bus2 = buses[1];
+            m_branchPositions[i] = {{findPosition(bus1, bus1), findPosition(bus1, bus2), findPosition(bus2, bus1), findPosition(bus2, bus2)}};
+        }
+    }
+}
+
+std::complex<double> AdmittanceMatrix::get(unsigned long row, unsigned long column) const {
+    if (row >= m_size || column >= m_size) {
+        throw PowsyblException(stdcxx::format("Invalid matrix position (%1%, %2%): size is %3%", row, column, m_size));
+    }
+    auto first = m_columnIndices.begin() + m_rowOffsets[row];
+    auto last = m_columnIndices.begin() + m_rowOffsets[row + 1];
+    auto it = std::lower_bound(first, last, column);
+    if (it != last && *it == column) {
+        return m_values[it - m_columnIndices.begin()];
+    }
+    return {};
+}
+
+unsigned long AdmittanceMatrix::getBusCount() const {
+    return m_busIndexes.size();
+}
+
+unsigned long AdmittanceMatrix::getBusIndex(const std::string& busId) const {
+    const auto& it = m_busIndexes.find(busId);
+    if (it == m_busIndexes.end()) {
+        throw PowsyblException(stdcxx::format("Bus %1% not found", busId));
+    }
+    return it->second;
+}
+
+long AdmittanceMatrix::getBusIndex(const Terminal& terminal) const {
+    const auto& bus = terminal.getBusView().getBus();
+    if (!bus) {
+        return -1;
+    }
+    const auto& it = m_busIndexes.find(bus.get().getId());
+    return it != m_busIndexes.end() ? static_cast<long>(it->second) : -1;
+}
+
+const std::vector<unsigned long>& AdmittanceMatrix::getColumnIndices() const {
+    return m_columnIndices;
+}
+
+const std::vector<unsigned long>& AdmittanceMatrix::getRowOffsets() const {
+    return m_rowOffsets;
+}
+
+unsigned long AdmittanceMatrix::getSize() const {
+    return m_size;
+}
+
+const std::vector<std::complex<double>>& AdmittanceMatrix::getValues() const {
+    return m_values;
+}
+
+void AdmittanceMatrix::scatter() {
+    std::fill(m_values.begin(), m_values.end(), std::complex<double>());
+    for (unsigned long i = 0; i < m_branchBuses.size(); ++i) {
+        if (m_branchBuses[i][0] >= 0) {
+            const auto& positions = m_branchPositions[i];
+            const auto& admittance = m_admittances[i];
+            m_values[positions[0]] += admittance.y11;
+            m_values[positions[1]] += admittance.y12;
+            m_values[positions[2]] += admittance.y21;
+            m_values[positions[3]] += admittance.y22;
+        }
+    }
+}
+
+void AdmittanceMatrix::setLegParameters(unsigned long index, const three_windings_transformer::Leg& leg, double ratedU0) {
+    const TransformerParameters& parameters = getTransformerParameters(leg, leg, leg.getR(), leg.getX(), leg.getG(), leg.getB(), ratedU0 / leg.getRatedU());
+    m_parameters.r[index] = parameters.r;
+    m_parameters.x[index] = parameters.x;
+    m_parameters.ratio1[index] = 1 / parameters.rho;
+    m_parameters.angle1[index] = -parameters.alpha;
+    m_parameters.g1[index] = parameters.g;
+    m_parameters.b1[index] = parameters.b;
+}
+
+void AdmittanceMatrix::setTwoWindingsTransformerParameters(unsigned long index, const TwoWindingsTransformer& twt) {
+    const TransformerParameters& parameters = getTransformerParameters(twt, twt, twt.getR(), twt.getX(), twt.getG(), twt.getB(), twt.getRatedU2() / twt.getRatedU1());
+    m_parameters.r[index] = parameters.r;
+    m_parameters.x[index] = parameters.x;
+    m_parameters.ratio1[index] = 1 / parameters.rho;
+    m_parameters.angle1[index] = -parameters.alpha;
+    m_parameters.g1[index] = parameters.g;
+    m_parameters.b1[index] = parameters.b;
+}
+
+void AdmittanceMatrix::updateTapPositions() {
+    unsigned long index = m_firstTransformer;
+    for (const auto& twt : m_twoWindingsTransformers) {
+        setTwoWindingsTransformerParameters(index++, twt.get());
+    }
+    for (const auto& leg : m_legs) {
+        setLegParameters(index++, leg.first.get(), leg.second);
+    }
+    LinkData::calculateBranchAdmittances(m_parameters, m_firstTransformer, m_parameters.size(), m_admittances);
+
+    scatter();
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
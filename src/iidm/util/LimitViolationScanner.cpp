@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/util/LimitViolationScanner.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <powsybl/AssertionError.hpp>
+#include <powsybl/iidm/Enum.hpp>
+#include <powsybl/iidm/LoadingLimits.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/StringPool.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/stdcxx/format.hpp>
+#include <powsybl/stdcxx/parallel.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+LimitViolationScanner::LimitViolationScanner(Network& network, const LimitType& type) :
+    m_network(network),
+    m_type(type) {
+
+    if (type == LimitType::VOLTAGE) {
+        throw AssertionError(stdcxx::format("Getting %1% limits is not supported", type));
+    }
+
+    m_offsets.push_back(0);
+    for (const Branch& branch : network.getBranches()) {
+        m_branches.emplace_back(std::cref(branch));
+        for (const Branch::Side& side : {Branch::Side::ONE, Branch::Side::TWO}) {
+            const auto& limits = branch.getLimits(type, side);
+            if (static_cast<bool>(limits) && !std::isnan(limits.get().getPermanentLimit())) {
+                m_limits.push_back(limits.get().getPermanentLimit());
+                m_acceptableDurations.push_back(std::numeric_limits<unsigned long>::max());
+                m_limitNames.emplace_back(StringPool::getEmptyString());
+                for (const auto& tl : limits.get().getTemporaryLimits()) { // iterate in ascending order
+                    m_limits.push_back(tl.getValue());
+                    m_acceptableDurations.push_back(tl.getAcceptableDuration());
+                    m_limitNames.emplace_back(tl.getName());
+                }
+            }
+            m_offsets.push_back(m_limits.size());
+        }
+    }
+}
+
+void LimitViolationScanner::check(const Flows& flows, double limitReduction, unsigned long begin, unsigned long end, std::vector<Violation>& violations) const {
+    const unsigned long first = 2 * begin;
+    const unsigned long last = 2 * end;
+
+    // Compute the values to compare to the limits, with the same formulas as Branch::getValueForLimit
+    std::vector<double> values(last - first);
+    const double* p = flows.p.data() + first;
+    const double* q = flows.q.data() + first;
+    const double* v = flows.v.data() + first;
+    switch (m_type) {
+        case LimitType::ACTIVE_POWER:
+            std::copy(p, p + values.size(), values.begin());
+            break;
+
+        case LimitType::APPARENT_POWER:
+            for (unsigned long i = 0; i < values.size(); ++i) {
+                values[i] = std::sqrt(p[i] * p[i] + q[i] * q[i]);
+            }
+            break;
+
+        case LimitType::CURRENT:
+            for (unsigned long i = 0; i < values.size(); ++i) {
+                values[i] = std::hypot(p[i], q[i]) / std::sqrt(3.0) * v[i] / 1000.0;
+            }
+            break;
+
+        case LimitType::VOLTAGE:
+        default:
+            throw AssertionError(stdcxx::format("Getting %1% limits is not supported", m_type));
+    }
+
+    for (unsigned long i = first; i < last; ++i) {
+        const unsigned long limitBegin = m_offsets[i];
+        const unsigned long limitEnd = m_offsets[i + 1];
+        const double value = values[i - first];
+        if (limitBegin == limitEnd || !std::isgreaterequal(value, m_limits[limitBegin] * limitReduction)) {
+            continue;
+        }
+
+        unsigned long limit = limitBegin;
+        while (limit + 1 < limitEnd && std::isgreaterequal(value, m_limits[limit + 1] * limitReduction)) {
+            ++limit;
+        }
+        violations.push_back({i / 2, (i % 2 == 0) ? Branch::Side::ONE : Branch::Side::TWO, limit, value});
+    }
+}
+
+unsigned long LimitViolationScanner::getAcceptableDuration(const Violation& violation) const {
+    const unsigned long slot = 2 * violation.branch + (violation.side == Branch::Side::ONE ? 0 : 1);
+    if (violation.limit + 1 < m_offsets[slot + 1]) {
+        return m_acceptableDurations[violation.limit + 1];
+    }
+    return isPermanentLimit(violation) ? std::numeric_limits<unsigned long>::max() : 0UL;
+}
+
+const Branch& LimitViolationScanner::getBranch(const Violation& violation) const {
+    return m_branches.at(violation.branch).get();
+}
+
+unsigned long LimitViolationScanner::getBranchCount() const {
+    return m_branches.size();
+}
+
+double LimitViolationScanner::getLimit(const Violation& violation) const {
+    return m_limits.at(violation.limit);
+}
+
+const std::string& LimitViolationScanner::getLimitName(const Violation& violation) const {
+    return m_limitNames.at(violation.limit);
+}
+
+const LimitType& LimitViolationScanner::getLimitType() const {
+    return m_type;
+}
+
+bool LimitViolationScanner::isPermanentLimit(const Violation& violation) const {
+    const unsigned long slot = 2 * violation.branch + (violation.side == Branch::Side::ONE ? 0 : 1);
+    return violation.limit == m_offsets[slot];
+}
+
+LimitViolationScanner::Flows LimitViolationScanner::readFlows() const {
+    Flows flows;
+    flows.p.reserve(2 * m_branches.size());
+    flows.q.reserve(2 * m_branches.size());
+    flows.v.reserve(2 * m_branches.size());
+    for (const auto& branch : m_branches) {
+        for (const Branch::Side& side : {Branch::Side::ONE, Branch::Side::TWO}) {
+            const Terminal& terminal = branch.get().getTerminal(side);
+            flows.p.push_back(terminal.getP());
+            flows.q.push_back(terminal.getQ());
+            flows.v.push_back(m_type == LimitType::CURRENT ? terminal.getV() : 0.0);
+        }
+    }
+    return flows;
+}
+
+std::vector<LimitViolationScanner::Violation> LimitViolationScanner::scan(double limitReduction, unsigned long threadCount) const {
+    const Flows& flows = readFlows();
+
+    std::vector<std::vector<Violation>> chunkViolations(std::max(1UL, threadCount));
+    unsigned long chunkCount = stdcxx::parallelFor(m_branches.size(), threadCount, [this, &flows, limitReduction, &chunkViolations](unsigned long chunk, unsigned long begin, unsigned long end) {
+        check(flows, limitReduction, begin, end, chunkViolations[chunk]);
+    });
+
+    std::vector<Violation> violations = std::move(chunkViolations[0]);
+    for (unsigned long chunk = 1; chunk < chunkCount; ++chunk) {
+        violations.insert(violations.end(), chunkViolations[chunk].begin(), chunkViolations[chunk].end());
+    }
+    return violations;
+}
+
+std::vector<std::vector<LimitViolationScanner::Violation>> LimitViolationScanner::scan(const std::vector<std::string>& variantIds, double limitReduction, unsigned long threadCount) const {
+    // The flows are read sequentially, as the working variant is shared by all the threads
+    VariantManager& variantManager = m_network.get().getVariantManager();
+    const std::string workingVariantId = variantManager.getWorkingVariantId();
+    std::vector<Flows> flows;
+    flows.reserve(variantIds.size());
+    try {
+        for (const auto& variantId : variantIds) {
+            variantManager.setWorkingVariant(variantId);
+            flows.emplace_back(readFlows());
+        }
+    } catch (...) {
+        variantManager.setWorkingVariant(workingVariantId);
+        throw;
+    }
+    variantManager.setWorkingVariant(workingVariantId);
+
+    std::vector<std::vector<Violation>> violations(variantIds.size());
+    stdcxx::parallelFor(variantIds.size(), threadCount, [this, &flows, limitReduction, &violations](unsigned long /*chunk*/, unsigned long begin, unsigned long end) {
+        for (unsigned long i = begin; i < end; ++i) {
+            check(flows[i], limitReduction, 0, m_branches.size(), violations[i]);
+        }
+    });
+    return violations;
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
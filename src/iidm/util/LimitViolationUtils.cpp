@@ -8,6 +8,7 @@
 #include <powsybl/iidm/util/LimitViolationUtils.hpp>
 
 #include <powsybl/iidm/CurrentLimits.hpp>
+#include <powsybl/iidm/StringPool.hpp>
 #include <powsybl/stdcxx/make_unique.hpp>
 #include <powsybl/stdcxx/reference.hpp>
 
@@ -29,14 +30,14 @@ std::unique_ptr<Branch::Overload> checkTemporaryLimits(const Branch& branch, con
     std::unique_ptr<Branch::Overload> res;
     stdcxx::CReference<LoadingLimits> limits = branch.getLimits(type, side);
     if (static_cast<bool>(limits) && !std::isnan(limits.get().getPermanentLimit()) && !std::isnan(i)) {
-        std::string previousLimitName;
+        std::reference_wrapper<const std::string> previousLimitName = StringPool::getEmptyString();
         double previousLimit = limits.get().getPermanentLimit();
         for (const auto& tl : limits.get().getTemporaryLimits()) { // iterate in ascending order
             if (std::isgreaterequal(i, previousLimit * limitReduction) && std::isless(i, tl.getValue() * limitReduction)) {
                 res = stdcxx::make_unique<Branch::Overload>(tl, previousLimitName, previousLimit);
                 break;
             }
-            previousLimitName = tl.getName();
+            previousLimitName = std::cref(tl.getName());
             previousLimit = tl.getValue();
         }
     }
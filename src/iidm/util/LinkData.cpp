@@ -7,12 +7,34 @@
 
 #include <powsybl/iidm/util/LinkData.hpp>
 
+#include <cmath>
+
+#include <powsybl/AssertionError.hpp>
+#include <powsybl/stdcxx/format.hpp>
+
 namespace powsybl {
 
 namespace iidm {
 
 namespace LinkData {
 
+void BranchAdmittanceParameters::resize(unsigned long size) {
+    r.resize(size);
+    x.resize(size);
+    ratio1.resize(size, 1.0);
+    angle1.resize(size);
+    ratio2.resize(size, 1.0);
+    angle2.resize(size);
+    g1.resize(size);
+    b1.resize(size);
+    g2.resize(size);
+    b2.resize(size);
+}
+
+unsigned long BranchAdmittanceParameters::size() const {
+    return r.size();
+}
+
 BranchAdmittanceMatrix calculateBranchAdmittance(double r, double x, double ratio1, double angle1,
                                                  double ratio2, double angle2, const std::complex<double>& ysh1, const std::complex<double>& ysh2) {
     std::complex<double> a1 = std::polar(ratio1, angle1);
@@ -33,6 +55,49 @@ BranchAdmittanceMatrix calculateBranchAdmittance(double r, double x, double rati
     return branchAdmittance;
 }
 
+void calculateBranchAdmittances(const BranchAdmittanceParameters& parameters, unsigned long begin, unsigned long end,
+                                std::vector<BranchAdmittanceMatrix>& admittances) {
+    if (end > parameters.size() || admittances.size() < parameters.size()) {
+        throw AssertionError(stdcxx::format("Invalid branch range [%1%, %2%) (size: %3%)", begin, end, parameters.size()));
+    }
+
+    const double* r = parameters.r.data();
+    const double* x = parameters.x.data();
+    const double* ratio1 = parameters.ratio1.data();
+    const double* angle1 = parameters.angle1.data();
+    const double* ratio2 = parameters.ratio2.data();
+    const double* angle2 = parameters.angle2.data();
+    const double* g1 = parameters.g1.data();
+    const double* b1 = parameters.b1.data();
+    const double* g2 = parameters.g2.data();
+    const double* b2 = parameters.b2.data();
+
+    // The complex expressions of calculateBranchAdmittance are expanded in real arithmetic:
+    //   ytr = 1 / (r + jx), y11 = (ytr + ysh1) / ratio1^2, y22 = (ytr + ysh2) / ratio2^2
+    //   y12 = -ytr / (ratio1 * ratio2) * exp(j(angle1 - angle2)), y21 = conj(exp(...)) instead
+    // This avoids the calls to the complex division runtime and keeps the loop free of branches.
+    for (unsigned long i = begin; i < end; ++i) {
+        const double z2 = r[i] * r[i] + x[i] * x[i];
+        const double invZ2 = (z2 != 0.0) ? 1.0 / z2 : 0.0;
+        const double ytrRe = r[i] * invZ2;
+        const double ytrIm = -x[i] * invZ2;
+
+        const double invRatio11 = 1.0 / (ratio1[i] * ratio1[i]);
+        const double invRatio22 = 1.0 / (ratio2[i] * ratio2[i]);
+        const double invRatio12 = 1.0 / (ratio1[i] * ratio2[i]);
+
+        const double theta = angle1[i] - angle2[i];
+        const double cosTheta = std::cos(theta);
+        const double sinTheta = std::sin(theta);
+
+        BranchAdmittanceMatrix& adm = admittances[i];
+        adm.y11 = std::complex<double>((ytrRe + g1[i]) * invRatio11, (ytrIm + b1[i]) * invRatio11);
+        adm.y12 = std::complex<double>(-(ytrRe * cosTheta - ytrIm * sinTheta) * invRatio12, -(ytrRe * sinTheta + ytrIm * cosTheta) * invRatio12);
+        adm.y21 = std::complex<double>(-(ytrRe * cosTheta + ytrIm * sinTheta) * invRatio12, -(ytrIm * cosTheta - ytrRe * sinTheta) * invRatio12);
+        adm.y22 = std::complex<double>((ytrRe + g2[i]) * invRatio22, (ytrIm + b2[i]) * invRatio22);
+    }
+}
+
 }  // namespace LinkData
 
 }  // namespace iidm
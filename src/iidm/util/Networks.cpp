@@ -7,6 +7,9 @@
 
 #include <powsybl/iidm/util/Networks.hpp>
 
+#include <functional>
+#include <vector>
+
 #include <powsybl/PowsyblException.hpp>
 #include <powsybl/iidm/Bus.hpp>
 #include <powsybl/iidm/Switch.hpp>
@@ -26,10 +29,7 @@ stdcxx::CReference<Terminal> getEquivalentTerminal(const VoltageLevel& voltageLe
 
     stdcxx::CReference<Terminal> equivalentTerminal;
 
-    VoltageLevel::NodeBreakerView::TopologyTraverser traverser = [&equivalentTerminal, &voltageLevel](unsigned long /*node1*/, const stdcxx::Reference<Switch>& sw, unsigned long node2) {
-        if (sw && sw.get().isOpen()) {
-            return math::TraverseResult::TERMINATE_PATH;
-        }
+    VoltageLevel::NodeBreakerView::TopologyTraverser traverser = [&equivalentTerminal, &voltageLevel](unsigned long /*node1*/, const stdcxx::Reference<Switch>& /*sw*/, unsigned long node2) {
         const auto& terminal = voltageLevel.getNodeBreakerView().getTerminal(node2);
         if (terminal) {
             equivalentTerminal = terminal;
@@ -38,7 +38,7 @@ stdcxx::CReference<Terminal> getEquivalentTerminal(const VoltageLevel& voltageLe
         return math::TraverseResult::CONTINUE;
     };
 
-    voltageLevel.getNodeBreakerView().traverse(node, traverser);
+    voltageLevel.getNodeBreakerView().traverseClosedSwitches(node, traverser);
 
     return equivalentTerminal;
 }
@@ -48,23 +48,21 @@ std::map<std::string, std::set<unsigned long>> getNodesByBus(const VoltageLevel&
         throw PowsyblException(stdcxx::format("The voltage level %1% is not described in Node/Breaker topology", voltageLevel.getId()));
     }
 
+    std::vector<stdcxx::CReference<Bus> > buses;
+    const std::vector<long> busIndexByNode = voltageLevel.getNodeBreakerView().getBusIndexByNode(buses);
+
     std::map<std::string, std::set<unsigned long>> nodesByBus;
-    for (unsigned long node : voltageLevel.getNodeBreakerView().getNodes()) {
-        const auto& terminal = voltageLevel.getNodeBreakerView().getTerminal(node);
-        if (terminal) {
-            const auto& bus = terminal.get().getBusView().getBus();
-            if (bus) {
-                nodesByBus[bus.get().getId()].insert(node);
-            }
-        } else {
-            // If there is no terminal for the current node, we try to find one traversing the topology
-            const auto& equivalentTerminal = getEquivalentTerminal(voltageLevel, node);
-            if (equivalentTerminal) {
-                const auto& bus = equivalentTerminal.get().getBusView().getBus();
-                if (bus) {
-                    nodesByBus[bus.get().getId()].insert(node);
-                }
-            }
+    std::vector<std::reference_wrapper<std::set<unsigned long> > > nodesByBusIndex;
+    nodesByBusIndex.reserve(buses.size());
+    for (const auto& bus : buses) {
+        nodesByBusIndex.emplace_back(std::ref(nodesByBus[bus.get().getId()]));
+    }
+
+    // Nodes are labelled in increasing order, so each insertion happens at the end of its set
+    for (unsigned long node = 0; node < busIndexByNode.size(); ++node) {
+        if (busIndexByNode[node] >= 0) {
+            std::set<unsigned long>& nodes = nodesByBusIndex[busIndexByNode[node]].get();
+            nodes.insert(nodes.end(), node);
         }
     }
 
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/iidm/util/ReactiveLimitsEvaluator.hpp>
+
+#include <algorithm>
+
+#include <powsybl/AssertionError.hpp>
+#include <powsybl/iidm/Generator.hpp>
+#include <powsybl/iidm/MinMaxReactiveLimits.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/ReactiveCapabilityCurve.hpp>
+#include <powsybl/stdcxx/format.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+ReactiveLimitsEvaluator::ReactiveLimitsEvaluator(const Network& network) {
+    m_offsets.push_back(0);
+    for (const Generator& generator : network.getGenerators()) {
+        m_generators.emplace_back(std::cref(generator));
+
+        const auto& limits = generator.getReactiveLimits<ReactiveLimits>();
+        switch (limits.getKind()) {
+            case ReactiveLimitsKind::CURVE:
+                for (const auto& point : generator.getReactiveLimits<ReactiveCapabilityCurve>().getPoints()) {
+                    m_p.push_back(point.getP());
+                    m_minQ.push_back(point.getMinQ());
+                    m_maxQ.push_back(point.getMaxQ());
+                }
+                break;
+
+            case ReactiveLimitsKind::MIN_MAX: {
+                const auto& minMaxLimits = generator.getReactiveLimits<MinMaxReactiveLimits>();
+                for (double p : {0.0, 1.0}) {
+                    m_p.push_back(p);
+                    m_minQ.push_back(minMaxLimits.getMinQ());
+                    m_maxQ.push_back(minMaxLimits.getMaxQ());
+                }
+                break;
+            }
+
+            default:
+                throw AssertionError("Unexpected reactive limits kind");
+        }
+        m_offsets.push_back(m_p.size());
+    }
+}
+
+const Generator& ReactiveLimitsEvaluator::getGenerator(unsigned long index) const {
+    return m_generators.at(index).get();
+}
+
+unsigned long ReactiveLimitsEvaluator::getGeneratorCount() const {
+    return m_generators.size();
+}
+
+void ReactiveLimitsEvaluator::getReactiveLimits(std::vector<double>& minQ, std::vector<double>& maxQ) const {
+    std::vector<double> p;
+    p.reserve(m_generators.size());
+    for (const auto& generator : m_generators) {
+        p.push_back(generator.get().getTargetP());
+    }
+    getReactiveLimits(p, minQ, maxQ);
+}
+
+void ReactiveLimitsEvaluator::getReactiveLimits(const std::vector<double>& p, std::vector<double>& minQ, std::vector<double>& maxQ) const {
+    if (p.size() != m_generators.size()) {
+        throw AssertionError(stdcxx::format("Unexpected active power count: %1% (expected: %2%)", p.size(), m_generators.size()));
+    }
+    minQ.resize(m_generators.size());
+    maxQ.resize(m_generators.size());
+
+    for (unsigned long i = 0; i < m_generators.size(); ++i) {
+        const unsigned long begin = m_offsets[i];
+        const unsigned long end = m_offsets[i + 1];
+
+        // Select the segment [k, k + 1] where k is the last point with an active power lower or equal to p, the first
+        // and last segments being extended. A NaN active power selects the first segment, like ReactiveCapabilityCurve.
+        unsigned long k = begin;
+        for (unsigned long j = begin + 1; j < end - 1; ++j) {
+            k += (m_p[j] <= p[i]) ? 1 : 0;
+        }
+
+        // Clamp the position in the segment to [0, 1] so that the curve is constant outside its active power range
+        const double t = std::min(1.0, std::max(0.0, (p[i] - m_p[k]) / (m_p[k + 1] - m_p[k])));
+        minQ[i] = m_minQ[k] + (m_minQ[k + 1] - m_minQ[k]) * t;
+        maxQ[i] = m_maxQ[k] + (m_maxQ[k + 1] - m_maxQ[k]) * t;
+    }
+}
+
+}  // namespace iidm
+
+}  // namespace powsybl
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <powsybl/stdcxx/Arena.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <powsybl/stdcxx/format.hpp>
+
+namespace stdcxx {
+
+Arena::Arena(std::size_t initialBlockSize, std::size_t maxBlockSize) :
+    m_nextBlockSize(std::max<std::size_t>(initialBlockSize, 1)),
+    m_maxBlockSize(std::max(initialBlockSize, maxBlockSize)) {
+}
+
+Arena::Arena(Arena&& arena) noexcept :
+    m_nextBlockSize(arena.m_nextBlockSize),
+    m_maxBlockSize(arena.m_maxBlockSize),
+    m_blocks(std::move(arena.m_blocks)),
+    m_current(arena.m_current),
+    m_remaining(arena.m_remaining),
+    m_usedSize(arena.m_usedSize) {
+    // The moved arena must not give memory from the blocks it no longer owns
+    arena.m_current = nullptr;
+    arena.m_remaining = 0;
+    arena.m_usedSize = 0;
+}
+
+Arena& Arena::operator=(Arena&& arena) noexcept {
+    if (this != &arena) {
+        m_nextBlockSize = arena.m_nextBlockSize;
+        m_maxBlockSize = arena.m_maxBlockSize;
+        m_blocks = std::move(arena.m_blocks);
+        m_current = arena.m_current;
+        m_remaining = arena.m_remaining;
+        m_usedSize = arena.m_usedSize;
+
+        arena.m_blocks.clear();
+        arena.m_current = nullptr;
+        arena.m_remaining = 0;
+        arena.m_usedSize = 0;
+    }
+    return *this;
+}
+
+void* Arena::allocate(std::size_t size, std::size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > alignof(std::max_align_t)) {
+        throw std::invalid_argument(format("Unsupported alignment: %1%", alignment));
+    }
+    size = std::max<std::size_t>(size, 1);
+
+    void* ptr = m_current;
+    std::size_t remaining = m_remaining;
+    if (std::align(alignment, size, ptr, remaining) == nullptr) {
+        // The blocks grow geometrically, and an object larger than the next block gets a block of its own. Memory
+        // allocated with new is suitably aligned for any fundamental type.
+        const std::size_t blockSize = std::max(m_nextBlockSize, size);
+        m_blocks.emplace_back(new char[blockSize]);
+        m_nextBlockSize = std::min(m_nextBlockSize * 2, m_maxBlockSize);
+
+        ptr = m_blocks.back().get();
+        remaining = blockSize;
+    } else {
+        // Count the padding
+        m_usedSize += m_remaining - remaining;
+    }
+
+    m_current = static_cast<char*>(ptr) + size;
+    m_remaining = remaining - size;
+    m_usedSize += size;
+
+    return ptr;
+}
+
+std::size_t Arena::getBlockCount() const {
+    return m_blocks.size();
+}
+
+std::size_t Arena::getUsedSize() const {
+    return m_usedSize;
+}
+
+}  // namespace stdcxx
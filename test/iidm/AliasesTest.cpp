@@ -266,6 +266,21 @@ BOOST_AUTO_TEST_CASE(emptyAliasType) {
     BOOST_CHECK_EQUAL("", load.getAliasType("Load alias#1"));
 }
 
+BOOST_AUTO_TEST_CASE(aliasesAfterMove) {
+    Network network = createNetwork();
+    const unsigned long stringCount = network.getStringPool().size();
+    network.getLoad("load1").addAlias("Load alias", "type");
+    network.getGenerator("generator1").addAlias("Generator alias", "type");
+    BOOST_CHECK_EQUAL(stringCount + 1, network.getStringPool().size());
+
+    // The aliases refer to the ids of the index, which are moved with the network
+    Network moved(std::move(network));
+    BOOST_CHECK(stdcxx::areSame(moved.getLoad("load1"), moved.find("Load alias").get()));
+    BOOST_CHECK_EQUAL("type", moved.getGenerator("generator1").getAliasType("Generator alias"));
+    moved.getLoad("load1").removeAlias("Load alias");
+    BOOST_CHECK(!moved.find("Load alias"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace iidm
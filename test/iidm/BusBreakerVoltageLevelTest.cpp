@@ -10,13 +10,17 @@
 #include <boost/test/unit_test.hpp>
 
 #include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/Component.hpp>
 #include <powsybl/iidm/Generator.hpp>
+#include <powsybl/iidm/Line.hpp>
 #include <powsybl/iidm/LineAdder.hpp>
 #include <powsybl/iidm/Load.hpp>
 #include <powsybl/iidm/LoadAdder.hpp>
 #include <powsybl/iidm/Network.hpp>
 #include <powsybl/iidm/Substation.hpp>
 #include <powsybl/iidm/Switch.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/iidm/VariantManager.hpp>
 #include <powsybl/iidm/VoltageLevelAdder.hpp>
 #include <powsybl/network/EurostagFactory.hpp>
 
@@ -373,7 +377,20 @@ BOOST_AUTO_TEST_CASE(CalculatedBusTopologyTest) {
     sw.setOpen(true);
     POWSYBL_ASSERT_REF_TRUE(busView.getBus("VL_0"));
     POWSYBL_ASSERT_REF_TRUE(busView.getBus("VL_1"));
+
+    // Merged buses whose configured buses are unchanged are kept by the next update
+    const unsigned long generation = vl.getTopologyGeneration();
+    Bus& bus0 = busView.getBus("VL_0").get();
+    Bus& bus1 = busView.getBus("VL_1").get();
+    vl.invalidateCache();
+    BOOST_CHECK_EQUAL(generation + 1, vl.getTopologyGeneration());
+    BOOST_TEST(stdcxx::areSame(bus0, busView.getBus("VL_0").get()));
+    BOOST_TEST(stdcxx::areSame(bus1, busView.getBus("VL_1").get()));
+    BOOST_TEST(stdcxx::areSame(bus0, busView.getMergedBus("BUS1").get()));
+    BOOST_CHECK_EQUAL(2UL, bus0.getConnectedTerminalCount());
+
     sw.setOpen(false);
+    BOOST_CHECK_EQUAL(generation + 2, vl.getTopologyGeneration());
     POWSYBL_ASSERT_REF_TRUE(busView.getBus("VL_0"));
     POWSYBL_ASSERT_REF_FALSE(busView.getBus("VL_1"));
 }
@@ -487,6 +504,63 @@ BOOST_AUTO_TEST_CASE(TerminalTest) {
     POWSYBL_ASSERT_THROW(cTerminal.getNodeBreakerView(), AssertionError, "Not implemented");
 }
 
+BOOST_AUTO_TEST_CASE(connectableBusPerVariant) {
+    Network network = powsybl::network::EurostagFactory::createTutorial1Network();
+    const Terminal& terminal = network.getGenerator("GEN").getTerminal();
+
+    const std::string& variantId = "Variant";
+    network.getVariantManager().cloneVariant(VariantManager::getInitialVariantId(), variantId);
+    network.getVariantManager().setWorkingVariant(variantId);
+    BOOST_CHECK_EQUAL("NGEN", terminal.getBusBreakerView().getConnectableBus().get().getId());
+    BOOST_CHECK_EQUAL(0UL, terminal.getBusBreakerView().getBus().get().getConnectedComponent().get().getNum());
+
+    network.getVariantManager().setWorkingVariant(VariantManager::getInitialVariantId());
+    network.getVariantManager().removeVariant(variantId);
+    network.getVariantManager().cloneVariant(VariantManager::getInitialVariantId(), variantId);
+    network.getVariantManager().setWorkingVariant(variantId);
+    BOOST_CHECK_EQUAL("NGEN", terminal.getBusBreakerView().getConnectableBus().get().getId());
+    BOOST_CHECK_EQUAL(0UL, terminal.getBusBreakerView().getBus().get().getSynchronousComponent().get().getNum());
+}
+
+BOOST_AUTO_TEST_CASE(busIndexByTerminal) {
+    Network network = powsybl::network::EurostagFactory::createTutorial1Network();
+    const VoltageLevel& vl = network.getVoltageLevel("VLHV1");
+    Terminal& lineTerminal = network.getLine("NHV1_NHV2_1").getTerminal1();
+
+    std::vector<stdcxx::CReference<Terminal> > terminals;
+    std::vector<stdcxx::CReference<Bus> > buses;
+    std::vector<long> busIndexByTerminal = vl.getBusView().getBusIndexByTerminal(terminals, buses);
+    BOOST_CHECK_EQUAL(3UL, terminals.size());
+    BOOST_CHECK_EQUAL(1UL, buses.size());
+    BOOST_CHECK_EQUAL("VLHV1_0", buses[0].get().getId());
+    const std::vector<long>& expectedBusIndexByTerminal = {0, 0, 0};
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedBusIndexByTerminal.begin(), expectedBusIndexByTerminal.end(), busIndexByTerminal.begin(), busIndexByTerminal.end());
+
+    // A disconnected terminal keeps its connectable bus but has no bus
+    BOOST_CHECK(lineTerminal.disconnect());
+    busIndexByTerminal = vl.getBusView().getBusIndexByTerminal(terminals, buses);
+    BOOST_CHECK_EQUAL(3UL, terminals.size());
+    BOOST_CHECK_EQUAL(1UL, buses.size());
+    for (unsigned long i = 0; i < terminals.size(); ++i) {
+        if (stdcxx::areSame(terminals[i].get(), lineTerminal)) {
+            BOOST_CHECK_EQUAL(-1, busIndexByTerminal[i]);
+            POWSYBL_ASSERT_REF_FALSE(terminals[i].get().getBusView().getBus());
+        } else {
+            BOOST_CHECK(stdcxx::areSame(buses[busIndexByTerminal[i]].get(), terminals[i].get().getBusView().getBus().get()));
+        }
+    }
+    BOOST_CHECK_EQUAL("VLHV1_0", lineTerminal.getBusView().getConnectableBus().get().getId());
+
+    // The terminal index stays dense when a connectable is removed
+    network.getLine("NHV1_NHV2_1").remove();
+    busIndexByTerminal = vl.getBusView().getBusIndexByTerminal(terminals, buses);
+    BOOST_CHECK_EQUAL(2UL, terminals.size());
+    for (unsigned long i = 0; i < terminals.size(); ++i) {
+        BOOST_CHECK_EQUAL(0, busIndexByTerminal[i]);
+        BOOST_CHECK(stdcxx::areSame(buses[0].get(), terminals[i].get().getBusView().getBus().get()));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(TestRemoveVoltageLevel) {
     Network network = createNetwork();
     network.remove(network.getVoltageLevel("VL2"));
@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <set>
+
+#include <boost/test/unit_test.hpp>
+
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/BusViewSnapshot.hpp>
+#include <powsybl/iidm/Generator.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/iidm/VariantManager.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/network/EurostagFactory.hpp>
+
+#include <powsybl/test/AssertionUtils.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+BOOST_AUTO_TEST_SUITE(BusViewSnapshotTestSuite)
+
+BOOST_AUTO_TEST_CASE(topologyGeneration) {
+    Network network = powsybl::network::EurostagFactory::createTutorial1Network();
+    VoltageLevel& vlgen = network.getVoltageLevel("VLGEN");
+    const VoltageLevel& vlload = network.getVoltageLevel("VLLOAD");
+
+    const unsigned long generation = network.getTopologyGeneration();
+    const unsigned long vlgenGeneration = vlgen.getTopologyGeneration();
+    const unsigned long vlloadGeneration = vlload.getTopologyGeneration();
+
+    Terminal& terminal = network.getGenerator("GEN").getTerminal();
+    BOOST_CHECK(terminal.disconnect());
+    BOOST_CHECK(network.getTopologyGeneration() > generation);
+    BOOST_CHECK(vlgen.getTopologyGeneration() > vlgenGeneration);
+    BOOST_CHECK_EQUAL(vlloadGeneration, vlload.getTopologyGeneration());
+
+    const unsigned long generation2 = network.getTopologyGeneration();
+    network.getGenerator("GEN").setTargetP(600.0);
+    BOOST_CHECK_EQUAL(generation2, network.getTopologyGeneration());
+
+    BOOST_CHECK(terminal.connect());
+    BOOST_CHECK(network.getTopologyGeneration() > generation2);
+}
+
+BOOST_AUTO_TEST_CASE(snapshot) {
+    Network network = powsybl::network::EurostagFactory::createTutorial1Network();
+    network.getBusView().getBus("VLGEN_0").get().setV(24.5).setAngle(2.3);
+
+    const BusViewSnapshot snapshot(network);
+    BOOST_CHECK_EQUAL(network.getTopologyGeneration(), snapshot.getTopologyGeneration());
+    BOOST_CHECK_EQUAL(0UL, snapshot.getVariantIndex());
+    BOOST_CHECK(snapshot.isUpToDate(network));
+    BOOST_CHECK_EQUAL(4UL, snapshot.getBuses().size());
+    BOOST_CHECK_EQUAL("VLGEN_0", snapshot.getBuses().front().getId());
+    BOOST_CHECK_EQUAL("VLLOAD_0", snapshot.getBuses().back().getId());
+    POWSYBL_ASSERT_REF_FALSE(snapshot.getBus("UNKNOWN"));
+
+    const BusViewSnapshot::Bus& bus = snapshot.getBus("VLGEN_0").get();
+    BOOST_CHECK_EQUAL("VLGEN", bus.getVoltageLevelId());
+    BOOST_CHECK_CLOSE(24.5, bus.getV(), std::numeric_limits<double>::epsilon());
+    BOOST_CHECK_CLOSE(2.3, bus.getAngle(), std::numeric_limits<double>::epsilon());
+    const std::set<std::string>& expectedConnectableIds = {"GEN", "NGEN_NHV1"};
+    const std::set<std::string> connectableIds(bus.getConnectableIds().begin(), bus.getConnectableIds().end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedConnectableIds.begin(), expectedConnectableIds.end(), connectableIds.begin(), connectableIds.end());
+
+    // The snapshot is not modified by the changes of the network
+    network.getBusView().getBus("VLGEN_0").get().setV(25.0);
+    network.getGenerator("GEN").getTerminal().disconnect();
+    BOOST_CHECK(!snapshot.isUpToDate(network));
+    BOOST_CHECK_CLOSE(24.5, bus.getV(), std::numeric_limits<double>::epsilon());
+    BOOST_CHECK_EQUAL(2UL, bus.getConnectableIds().size());
+
+    network.getVariantManager().cloneVariant(VariantManager::getInitialVariantId(), "s1");
+    const BusViewSnapshot snapshot2(network);
+    BOOST_CHECK(snapshot2.isUpToDate(network));
+    network.getVariantManager().setWorkingVariant("s1");
+    BOOST_CHECK(!snapshot2.isUpToDate(network));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace iidm
+
+}  // namespace powsybl
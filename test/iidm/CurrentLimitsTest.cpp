@@ -5,6 +5,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <cmath>
 #include <limits>
 
 #include <boost/test/unit_test.hpp>
@@ -16,6 +17,7 @@
 #include <powsybl/iidm/LineAdder.hpp>
 #include <powsybl/iidm/Substation.hpp>
 #include <powsybl/iidm/ValidationException.hpp>
+#include <powsybl/iidm/util/LimitViolationScanner.hpp>
 #include <powsybl/logging/ContainerLogger.hpp>
 #include <powsybl/logging/LogMessage.hpp>
 #include <powsybl/stdcxx/math.hpp>
@@ -203,6 +205,14 @@ BOOST_AUTO_TEST_CASE(constructor) {
     BOOST_TEST(!tl.isFictitious());
     BOOST_TEST(!tl2.isFictitious());
     BOOST_CHECK_CLOSE(tl.getValue(), limits.getTemporaryLimitValue(tl.getAcceptableDuration()), std::numeric_limits<double>::epsilon());
+
+    // Names are interned in the network
+    BOOST_TEST(stdcxx::areSame(tl.getName(), network.getStringPool().intern("TL1")));
+
+    BOOST_TEST(std::isnan(limits.getTemporaryLimitValue(4UL)));
+    BOOST_TEST(std::isnan(limits.getTemporaryLimitValue(0UL)));
+    POWSYBL_ASSERT_THROW(limits.getTemporaryLimit(4UL), PowsyblException, "Temporary limit with acceptable duration 4 not found");
+    POWSYBL_ASSERT_THROW(cLimits.getTemporaryLimit(0UL), PowsyblException, "Temporary limit with acceptable duration 0 not found");
 }
 
 BOOST_AUTO_TEST_CASE(integrity) {
@@ -563,6 +573,80 @@ BOOST_AUTO_TEST_CASE(checkTemporaryLimitsTest) {
     BOOST_CHECK_EQUAL(2UL, line.getOverloadDuration());
 }
 
+BOOST_AUTO_TEST_CASE(limitViolationScannerTest) {
+    Network network = createCurrentLimitsTestNetwork();
+
+    Line& line = network.getLine("VL1_VL3");
+    line.newCurrentLimits2()
+        .setPermanentLimit(8.0)
+        .add();
+    Terminal& t1 = line.getTerminal1();
+    Terminal& t2 = line.getTerminal2();
+    network.getVoltageLevel("VL1").getBusBreakerView().getBus("VL1_BUS1").get().setV(1000.0 * std::sqrt(3.0));
+    network.getVoltageLevel("VL3").getBusBreakerView().getBus("VL3_BUS1").get().setV(1000.0 * std::sqrt(3.0));
+    t1.setQ(0.0).setP(9.0);
+    t2.setQ(0.0).setP(1.0);
+
+    LimitViolationScanner scanner(network);
+    BOOST_CHECK_EQUAL(1UL, scanner.getBranchCount());
+    BOOST_CHECK_EQUAL(LimitType::CURRENT, scanner.getLimitType());
+    POWSYBL_ASSERT_THROW(LimitViolationScanner(network, LimitType::VOLTAGE), AssertionError, "Getting VOLTAGE limits is not supported");
+
+    // Same results as Branch::checkTemporaryLimits
+    std::vector<LimitViolationScanner::Violation> violations = scanner.scan(2.0);
+    BOOST_CHECK_EQUAL(1UL, violations.size());
+    BOOST_TEST(stdcxx::areSame(line, scanner.getBranch(violations[0])));
+    BOOST_CHECK_EQUAL(Branch::Side::ONE, violations[0].side);
+    BOOST_CHECK_CLOSE(9.0, violations[0].value, std::numeric_limits<double>::epsilon());
+    BOOST_TEST(scanner.isPermanentLimit(violations[0]));
+    BOOST_CHECK_EQUAL("", scanner.getLimitName(violations[0]));
+    BOOST_CHECK_CLOSE(4.0, scanner.getLimit(violations[0]), std::numeric_limits<double>::epsilon());
+    BOOST_CHECK_EQUAL(3UL, scanner.getAcceptableDuration(violations[0]));
+
+    t1.setP(11.0);
+    violations = scanner.scan(2.0);
+    BOOST_CHECK_EQUAL(1UL, violations.size());
+    BOOST_TEST(!scanner.isPermanentLimit(violations[0]));
+    BOOST_CHECK_EQUAL("TL3", scanner.getLimitName(violations[0]));
+    BOOST_CHECK_CLOSE(5.0, scanner.getLimit(violations[0]), std::numeric_limits<double>::epsilon());
+    BOOST_CHECK_EQUAL(2UL, scanner.getAcceptableDuration(violations[0]));
+
+    t1.setP(15.0);
+    violations = scanner.scan(2.0);
+    BOOST_CHECK_EQUAL(1UL, violations.size());
+    BOOST_CHECK_EQUAL("TL1", scanner.getLimitName(violations[0]));
+    BOOST_CHECK_EQUAL(0UL, scanner.getAcceptableDuration(violations[0]));
+
+    t1.setP(1.0);
+    BOOST_TEST(scanner.scan(2.0).empty());
+
+    t2.setP(20.0);
+    violations = scanner.scan(1.0, 4);
+    BOOST_CHECK_EQUAL(1UL, violations.size());
+    BOOST_CHECK_EQUAL(Branch::Side::TWO, violations[0].side);
+    BOOST_TEST(scanner.isPermanentLimit(violations[0]));
+    BOOST_CHECK_EQUAL(std::numeric_limits<unsigned long>::max(), scanner.getAcceptableDuration(violations[0]));
+
+    // Multiple variants
+    network.getVariantManager().cloneVariant(VariantManager::getInitialVariantId(), "v2");
+    network.getVariantManager().setWorkingVariant("v2");
+    t1.setP(9.0);
+    t2.setP(1.0);
+    network.getVariantManager().setWorkingVariant(VariantManager::getInitialVariantId());
+
+    const auto& variantViolations = scanner.scan({"v2", VariantManager::getInitialVariantId()}, 1.0, 2);
+    BOOST_CHECK_EQUAL(VariantManager::getInitialVariantId(), network.getVariantManager().getWorkingVariantId());
+    BOOST_CHECK_EQUAL(2UL, variantViolations.size());
+    BOOST_CHECK_EQUAL(1UL, variantViolations[0].size());
+    BOOST_CHECK_EQUAL(Branch::Side::ONE, variantViolations[0][0].side);
+    BOOST_CHECK_EQUAL("TL1", scanner.getLimitName(variantViolations[0][0]));
+    BOOST_CHECK_EQUAL(1UL, variantViolations[1].size());
+    BOOST_CHECK_EQUAL(Branch::Side::TWO, variantViolations[1][0].side);
+
+    POWSYBL_ASSERT_THROW(scanner.scan({"v2", "unknown"}), PowsyblException, "Variant 'unknown' not found");
+    BOOST_CHECK_EQUAL(VariantManager::getInitialVariantId(), network.getVariantManager().getWorkingVariantId());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace iidm
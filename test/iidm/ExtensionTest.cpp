@@ -8,6 +8,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <powsybl/iidm/Battery.hpp>
+#include <powsybl/iidm/Generator.hpp>
 #include <powsybl/iidm/Load.hpp>
 #include <powsybl/iidm/Network.hpp>
 #include <powsybl/network/EurostagFactory.hpp>
@@ -41,6 +42,40 @@ BOOST_AUTO_TEST_CASE(getExtensionByName) {
     BOOST_CHECK(ext);
 }
 
+BOOST_AUTO_TEST_CASE(extendedIdentifiables) {
+    Network network = powsybl::network::EurostagFactory::createTutorial1Network();
+    Load& load = network.getLoad("LOAD");
+    Generator& generator = network.getGenerator("GEN");
+    BOOST_CHECK(boost::empty(network.getExtendedIdentifiables<powsybl::network::LoadFooExt>()));
+
+    load.addExtension(stdcxx::make_unique<powsybl::network::LoadFooExt>(load));
+    load.addExtension(stdcxx::make_unique<powsybl::network::LoadBarExt>(load));
+    BOOST_CHECK(load.findExtension<powsybl::network::LoadFooExt>());
+    BOOST_CHECK_EQUAL("loadFoo", load.getExtension<powsybl::network::LoadFooExt>().getName());
+    BOOST_CHECK_EQUAL(1, boost::size(network.getExtendedIdentifiables<powsybl::network::LoadFooExt>()));
+    BOOST_CHECK(stdcxx::areSame(load, *network.getExtendedIdentifiables<powsybl::network::LoadFooExt>().begin()));
+    const Network& cNetwork = network;
+    BOOST_CHECK_EQUAL(1, boost::size(cNetwork.getExtendedIdentifiables<powsybl::network::LoadBarExt>()));
+
+    // The extensions are sorted by name
+    std::vector<std::string> names;
+    for (const Extension& extension : load.getExtensions()) {
+        names.push_back(extension.getName());
+    }
+    const std::vector<std::string>& expectedNames = {"loadBar", "loadFoo"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedNames.cbegin(), expectedNames.cend(), names.cbegin(), names.cend());
+
+    load.removeExtension<powsybl::network::LoadFooExt>();
+    BOOST_CHECK(!load.findExtension<powsybl::network::LoadFooExt>());
+    BOOST_CHECK(boost::empty(network.getExtendedIdentifiables<powsybl::network::LoadFooExt>()));
+    BOOST_CHECK_EQUAL(1, boost::size(network.getExtendedIdentifiables<powsybl::network::LoadBarExt>()));
+
+    // The extensions of a removed identifiable are not indexed anymore
+    load.remove();
+    BOOST_CHECK(boost::empty(network.getExtendedIdentifiables<powsybl::network::LoadBarExt>()));
+    BOOST_CHECK(boost::empty(generator.getExtensions()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace iidm
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <powsybl/iidm/Load.hpp>
+#include <powsybl/iidm/LoadAdder.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/NetworkJournal.hpp>
+#include <powsybl/iidm/NetworkListener.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/stdcxx/math.hpp>
+
+#include <powsybl/test/AssertionUtils.hpp>
+
+#include "NetworkFactory.hpp"
+
+namespace powsybl {
+
+namespace iidm {
+
+class CountingListener : public NetworkListener {
+public:
+    void afterRemoval(const std::string& /*id*/) override {
+        ++m_removalCount;
+    }
+
+    void beforeRemoval(const Identifiable& /*identifiable*/) override {
+        ++m_removalCount;
+    }
+
+    void onCreation(const Identifiable& /*identifiable*/) override {
+        ++m_creationCount;
+    }
+
+    void onUpdate(const Identifiable& /*identifiable*/, const std::string& /*attribute*/, unsigned long /*variantIndex*/, double /*oldValue*/, double /*newValue*/) override {
+        ++m_updateCount;
+    }
+
+public:
+    unsigned long m_creationCount = 0;
+
+    unsigned long m_removalCount = 0;
+
+    unsigned long m_updateCount = 0;
+};
+
+BOOST_AUTO_TEST_SUITE(NetworkJournalTestSuite)
+
+BOOST_AUTO_TEST_CASE(listener) {
+    Network network = createNetwork();
+    CountingListener listener;
+    network.addListener(listener);
+
+    VoltageLevel& vl1 = network.getVoltageLevel("VL1");
+    Load& load = vl1.newLoad()
+        .setId("LOAD2")
+        .setBus("VL1_BUS1")
+        .setConnectableBus("VL1_BUS1")
+        .setP0(10.0)
+        .setQ0(5.0)
+        .add();
+    BOOST_CHECK_EQUAL(1UL, listener.m_creationCount);
+
+    load.setP0(20.0);
+    load.setP0(20.0);
+    load.setQ0(10.0);
+    BOOST_CHECK_EQUAL(2UL, listener.m_updateCount);
+
+    load.remove();
+    BOOST_CHECK_EQUAL(2UL, listener.m_removalCount);
+
+    network.removeListener(listener);
+    network.getLoad("LOAD1").setP0(0.0);
+    BOOST_CHECK_EQUAL(2UL, listener.m_updateCount);
+}
+
+BOOST_AUTO_TEST_CASE(journal) {
+    Network network = createNetwork();
+    POWSYBL_ASSERT_THROW(NetworkJournal(network, 0), PowsyblException, "Network journal capacity must be > 0");
+    BOOST_CHECK(network.getListeners().empty());
+
+    Load& load1 = network.getLoad("LOAD1");
+    {
+        NetworkJournal journal(network, 3);
+        BOOST_CHECK_EQUAL(3UL, journal.getCapacity());
+        BOOST_CHECK_EQUAL(0UL, journal.getEventCount());
+        POWSYBL_ASSERT_THROW(journal.getEvent(0), PowsyblException, "Event index 0 out of range [0, 0)");
+
+        load1.setP0(60.0);
+        load1.getTerminal().disconnect();
+        BOOST_CHECK_EQUAL(2UL, journal.getEventCount());
+
+        const NetworkJournal::Event& event = journal.getEvent(0);
+        BOOST_CHECK(event.type == NetworkJournal::EventType::UPDATE);
+        BOOST_CHECK_EQUAL("LOAD1", event.id.get());
+        BOOST_CHECK_EQUAL("p0", event.attribute.get());
+        BOOST_CHECK_EQUAL(0UL, event.variantIndex);
+        BOOST_CHECK_CLOSE(50.0, event.oldValue, std::numeric_limits<double>::epsilon());
+        BOOST_CHECK_CLOSE(60.0, event.newValue, std::numeric_limits<double>::epsilon());
+
+        const NetworkJournal::Event& event2 = journal.getEvent(1);
+        BOOST_CHECK_EQUAL("connected", event2.attribute.get());
+        BOOST_CHECK_CLOSE(1.0, event2.oldValue, std::numeric_limits<double>::epsilon());
+        BOOST_CHECK_CLOSE(0.0, event2.newValue, std::numeric_limits<double>::epsilon());
+
+        // Once the journal is full, the oldest events are overwritten
+        load1.setQ0(30.0);
+        load1.remove();
+        BOOST_CHECK_EQUAL(3UL, journal.getEventCount());
+        BOOST_CHECK_EQUAL(4UL, journal.getRecordedEventCount());
+        BOOST_CHECK_EQUAL("connected", journal.getEvent(0).attribute.get());
+        BOOST_CHECK_EQUAL("q0", journal.getEvent(1).attribute.get());
+
+        const NetworkJournal::Event& event3 = journal.getEvent(2);
+        BOOST_CHECK(event3.type == NetworkJournal::EventType::REMOVAL);
+        BOOST_CHECK_EQUAL("LOAD1", event3.id.get());
+        BOOST_CHECK(event3.attribute.get().empty());
+        BOOST_CHECK(std::isnan(event3.oldValue));
+        POWSYBL_ASSERT_THROW(journal.getEvent(3), PowsyblException, "Event index 3 out of range [0, 3)");
+
+        journal.clear();
+        BOOST_CHECK_EQUAL(0UL, journal.getEventCount());
+        BOOST_CHECK_EQUAL(0UL, journal.getRecordedEventCount());
+
+        network.getVoltageLevel("VL1").newLoad()
+            .setId("LOAD2")
+            .setBus("VL1_BUS1")
+            .setConnectableBus("VL1_BUS1")
+            .setP0(10.0)
+            .setQ0(5.0)
+            .add();
+        BOOST_CHECK_EQUAL(1UL, journal.getEventCount());
+        BOOST_CHECK(journal.getEvent(0).type == NetworkJournal::EventType::CREATION);
+        BOOST_CHECK_EQUAL("LOAD2", journal.getEvent(0).id.get());
+    }
+    BOOST_CHECK(network.getListeners().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace iidm
+
+}  // namespace powsybl
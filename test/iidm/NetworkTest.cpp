@@ -5,6 +5,10 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include <boost/test/unit_test.hpp>
 
 #include <powsybl/iidm/Bus.hpp>
@@ -23,6 +27,8 @@
 #include <powsybl/iidm/TwoWindingsTransformer.hpp>
 #include <powsybl/iidm/TwoWindingsTransformerAdder.hpp>
 #include <powsybl/iidm/ValidationException.hpp>
+#include <powsybl/iidm/VariantManager.hpp>
+#include <powsybl/network/FourSubstationsNodeBreakerFactory.hpp>
 #include <powsybl/stdcxx/exception.hpp>
 #include <powsybl/stdcxx/memory.hpp>
 
@@ -352,6 +358,13 @@ BOOST_AUTO_TEST_CASE(Properties) {
 
     BOOST_CHECK(!n.hasProperty("key2"));
 
+    // The keys are interned in the string pool of the network
+    const std::string& key1 = *n.getPropertyNames().begin();
+    BOOST_CHECK(stdcxx::areSame(n.getStringPool().intern("key1"), key1));
+    BOOST_CHECK(!n.setProperty("key3", "value3"));
+    BOOST_CHECK_EQUAL("value3", *n.setProperty("key3", "value4"));
+    BOOST_CHECK_EQUAL("value4", n.getProperty("key3"));
+
     BOOST_CHECK(!n.removeProperty("badKey"));
 }
 
@@ -375,6 +388,54 @@ BOOST_AUTO_TEST_CASE(MultiVariant) {
     BOOST_CHECK_EQUAL(false, ext.getValue());
 }
 
+std::vector<std::string> getBusIds(const stdcxx::const_range<Bus>& buses) {
+    std::vector<std::string> ids;
+    for (const Bus& bus : buses) {
+        ids.emplace_back(bus.getId());
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+BOOST_AUTO_TEST_CASE(precomputeTopology) {
+    Network network = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    Network expected = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    expected.getSwitch("S1VL2_COUPLER").setOpen(true);
+
+    VariantManager& variantManager = network.getVariantManager();
+    variantManager.cloneVariant(VariantManager::getInitialVariantId(), "v");
+    variantManager.allowVariantMultiThreadAccess(true);
+    variantManager.setWorkingVariant("v");
+    network.getSwitch("S1VL2_COUPLER").setOpen(true);
+
+    const unsigned long topologyGeneration = network.getTopologyGeneration();
+    network.precomputeTopology(4);
+    BOOST_CHECK_EQUAL(topologyGeneration, network.getTopologyGeneration());
+    BOOST_CHECK_EQUAL("v", variantManager.getWorkingVariantId());
+
+    const Network& cNetwork = network;
+    const Network& cExpected = expected;
+    const std::vector<std::string>& busIds = getBusIds(cNetwork.getBusView().getBuses());
+    const std::vector<std::string>& expectedBusIds = getBusIds(cExpected.getBusView().getBuses());
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedBusIds.begin(), expectedBusIds.end(), busIds.begin(), busIds.end());
+    for (const std::string& busId : busIds) {
+        POWSYBL_ASSERT_REF_TRUE(cNetwork.getBusView().getBus(busId));
+    }
+
+    const std::vector<std::string>& busBreakerIds = getBusIds(cNetwork.getBusBreakerView().getBuses());
+    const std::vector<std::string>& expectedBusBreakerIds = getBusIds(cExpected.getBusBreakerView().getBuses());
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedBusBreakerIds.begin(), expectedBusBreakerIds.end(), busBreakerIds.begin(), busBreakerIds.end());
+
+    // The initial variant is not affected
+    variantManager.setWorkingVariant(VariantManager::getInitialVariantId());
+    BOOST_CHECK(!network.getSwitch("S1VL2_COUPLER").isOpen());
+    network.precomputeTopology(2);
+    expected.getSwitch("S1VL2_COUPLER").setOpen(false);
+    const std::vector<std::string>& initialBusIds = getBusIds(cNetwork.getBusView().getBuses());
+    const std::vector<std::string>& expectedInitialBusIds = getBusIds(cExpected.getBusView().getBuses());
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedInitialBusIds.begin(), expectedInitialBusIds.end(), initialBusIds.begin(), initialBusIds.end());
+}
+
 BOOST_AUTO_TEST_CASE(NullSubstationTestNBK) {
     Network network("test", "test");
     VoltageLevel& voltageLevel = network.newVoltageLevel()
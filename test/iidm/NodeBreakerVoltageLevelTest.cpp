@@ -6,11 +6,15 @@
  */
 
 #include <cmath>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <boost/test/unit_test.hpp>
 
 #include <powsybl/iidm/Bus.hpp>
 #include <powsybl/iidm/BusbarSection.hpp>
+#include <powsybl/iidm/Generator.hpp>
 #include <powsybl/iidm/InternalConnection.hpp>
 #include <powsybl/iidm/Line.hpp>
 #include <powsybl/iidm/LineAdder.hpp>
@@ -19,10 +23,14 @@
 #include <powsybl/iidm/Network.hpp>
 #include <powsybl/iidm/Substation.hpp>
 #include <powsybl/iidm/Switch.hpp>
+#include <powsybl/iidm/Terminal.hpp>
 #include <powsybl/iidm/TwoWindingsTransformer.hpp>
+#include <powsybl/iidm/VariantManager.hpp>
 #include <powsybl/iidm/VoltageLevel.hpp>
 #include <powsybl/iidm/VoltageLevelAdder.hpp>
+#include <powsybl/iidm/util/Networks.hpp>
 #include <powsybl/network/FourSubstationsNodeBreakerFactory.hpp>
+#include <powsybl/stdcxx/Properties.hpp>
 
 #include <powsybl/test/AssertionUtils.hpp>
 
@@ -952,6 +960,34 @@ BOOST_AUTO_TEST_CASE(CalculatedBusTopology) {
     BOOST_CHECK_EQUAL(2UL, boost::size(cBusView.getBuses()));
     POWSYBL_ASSERT_REF_TRUE(busView.getBus("VL_0"));
     POWSYBL_ASSERT_REF_TRUE(busView.getBus("VL_2"));
+    POWSYBL_ASSERT_REF_FALSE(busView.getBus("VL_1"));
+    POWSYBL_ASSERT_REF_FALSE(busView.getBus("VL_3"));
+    BOOST_CHECK_EQUAL("VL_0", busView.getBuses().front().getId());
+
+    std::vector<stdcxx::CReference<Bus> > buses;
+    const std::vector<long>& busIndexByNode = vl.getNodeBreakerView().getBusIndexByNode(buses);
+    BOOST_CHECK_EQUAL(2UL, buses.size());
+    BOOST_CHECK_EQUAL("VL_0", buses[0].get().getId());
+    BOOST_CHECK_EQUAL("VL_2", buses[1].get().getId());
+    const std::vector<long>& expectedBusIndexByNode = {0, 0, 1, 1};
+    BOOST_CHECK_EQUAL_COLLECTIONS(expectedBusIndexByNode.begin(), expectedBusIndexByNode.end(), busIndexByNode.begin(), busIndexByNode.end());
+
+    std::vector<stdcxx::CReference<Terminal> > terminals;
+    const std::vector<long>& busIndexByTerminal = cBusView.getBusIndexByTerminal(terminals, buses);
+    BOOST_CHECK_EQUAL(2UL, buses.size());
+    BOOST_CHECK_EQUAL(4UL, terminals.size());
+    BOOST_CHECK_EQUAL(4UL, busIndexByTerminal.size());
+    for (unsigned long i = 0; i < terminals.size(); ++i) {
+        BOOST_CHECK(stdcxx::areSame(buses[busIndexByTerminal[i]].get(), terminals[i].get().getBusView().getBus().get()));
+    }
+
+    const auto& nodesByBus = Networks::getNodesByBus(vl);
+    BOOST_CHECK_EQUAL(2UL, nodesByBus.size());
+    const std::set<unsigned long>& expectedNodes0 = {0, 1};
+    const std::set<unsigned long>& expectedNodes2 = {2, 3};
+    BOOST_CHECK(expectedNodes0 == nodesByBus.at("VL_0"));
+    BOOST_CHECK(expectedNodes2 == nodesByBus.at("VL_2"));
+    BOOST_CHECK(Networks::getNodesByBus(vl2).empty());
     sw.setOpen(false);
     BOOST_CHECK_EQUAL(1UL, boost::size(busView.getBuses()));
     BOOST_CHECK_EQUAL(1UL, boost::size(cBusView.getBuses()));
@@ -1434,6 +1470,160 @@ BOOST_AUTO_TEST_CASE(testCalculatedBus) {
     BOOST_CHECK(!network.getBusBreakerView().getBus("unknownBus"));
 }
 
+BOOST_AUTO_TEST_CASE(switchStatesByVariant) {
+    Network network("test", "test");
+    Substation& substation = network.newSubstation()
+        .setId("S")
+        .add();
+    VoltageLevel& vl = substation.newVoltageLevel()
+        .setId("VL")
+        .setTopologyKind(TopologyKind::NODE_BREAKER)
+        .setNominalV(400.0)
+        .add();
+    vl.newLoad()
+        .setId("L0")
+        .setNode(0)
+        .setLoadType(LoadType::UNDEFINED)
+        .setP0(10.0)
+        .setQ0(1.0)
+        .add();
+    vl.newLoad()
+        .setId("L2")
+        .setNode(2)
+        .setLoadType(LoadType::UNDEFINED)
+        .setP0(10.0)
+        .setQ0(1.0)
+        .add();
+    Switch& bk1 = vl.getNodeBreakerView().newBreaker()
+        .setId("BK1")
+        .setNode1(0)
+        .setNode2(1)
+        .setRetained(true)
+        .setOpen(false)
+        .add();
+    Switch& d1 = vl.getNodeBreakerView().newDisconnector()
+        .setId("D1")
+        .setNode1(1)
+        .setNode2(2)
+        .setRetained(false)
+        .setOpen(false)
+        .add();
+
+    const auto& getClosedNodes = [&vl](unsigned long node) {
+        std::set<unsigned long> nodes;
+        vl.getNodeBreakerView().traverseClosedSwitches(node, [&nodes](unsigned long /*node1*/, const stdcxx::Reference<Switch>& /*sw*/, unsigned long node2) {
+            nodes.insert(node2);
+            return math::TraverseResult::CONTINUE;
+        });
+        return nodes;
+    };
+
+    BOOST_CHECK_EQUAL(1UL, vl.getBusBreakerView().getSwitchCount());
+    BOOST_CHECK_EQUAL(2UL, boost::size(vl.getBusBreakerView().getBuses()));
+    std::set<unsigned long> expected = {1, 2};
+    std::set<unsigned long> actual = getClosedNodes(0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+
+    network.getVariantManager().cloneVariant(VariantManager::getInitialVariantId(), "v");
+    network.getVariantManager().setWorkingVariant("v");
+    d1.setOpen(true);
+    BOOST_CHECK_EQUAL(3UL, boost::size(vl.getBusBreakerView().getBuses()));
+    expected = {1};
+    actual = getClosedNodes(0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+    BOOST_CHECK(stdcxx::areSame(network.getLoad("L0").getTerminal(), Networks::getEquivalentTerminal(vl, 1).get()));
+    d1.setRetained(true);
+    BOOST_CHECK_EQUAL(2UL, vl.getBusBreakerView().getSwitchCount());
+
+    // The switch states of the initial variant are not affected
+    network.getVariantManager().setWorkingVariant(VariantManager::getInitialVariantId());
+    BOOST_CHECK_EQUAL(1UL, vl.getBusBreakerView().getSwitchCount());
+    BOOST_CHECK_EQUAL(2UL, boost::size(vl.getBusBreakerView().getBuses()));
+    expected = {1, 2};
+    actual = getClosedNodes(0);
+    BOOST_CHECK_EQUAL_COLLECTIONS(expected.begin(), expected.end(), actual.begin(), actual.end());
+
+    // Adding or removing a switch updates the switch states of all the variants
+    vl.getNodeBreakerView().newBreaker()
+        .setId("BK2")
+        .setNode1(2)
+        .setNode2(3)
+        .setRetained(true)
+        .setOpen(true)
+        .add();
+    BOOST_CHECK_EQUAL(2UL, vl.getBusBreakerView().getSwitchCount());
+    network.getVariantManager().setWorkingVariant("v");
+    BOOST_CHECK_EQUAL(3UL, vl.getBusBreakerView().getSwitchCount());
+    vl.getNodeBreakerView().removeSwitch("D1");
+    BOOST_CHECK_EQUAL(2UL, vl.getBusBreakerView().getSwitchCount());
+    BOOST_CHECK(vl.getBusBreakerView().getSwitch("BK1"));
+    bk1.setOpen(true);
+    BOOST_CHECK(!Networks::getEquivalentTerminal(vl, 1));
+}
+
+BOOST_AUTO_TEST_CASE(incrementalBusBreakerTopology) {
+    Network network = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    Network expected = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    VoltageLevel& vl = network.getVoltageLevel("S1VL2");
+    VoltageLevel& expectedVl = expected.getVoltageLevel("S1VL2");
+
+    const auto& getBusIds = [](VoltageLevel& voltageLevel) {
+        std::vector<std::string> ids;
+        for (const Bus& bus : voltageLevel.getBusBreakerView().getBuses()) {
+            ids.push_back(bus.getId());
+        }
+        return ids;
+    };
+    const auto& checkBuses = [&]() {
+        // The updated buses are the same as the buses computed from scratch, and still sorted by id
+        const std::vector<std::string>& ids = getBusIds(vl);
+        const std::vector<std::string>& expectedIds = getBusIds(expectedVl);
+        BOOST_CHECK_EQUAL_COLLECTIONS(expectedIds.begin(), expectedIds.end(), ids.begin(), ids.end());
+        for (unsigned long node : expectedVl.getNodeBreakerView().getNodes()) {
+            const auto& expectedTerminal = expectedVl.getNodeBreakerView().getOptionalTerminal(node);
+            if (static_cast<bool>(expectedTerminal)) {
+                const auto& expectedBus = expectedTerminal.get().getBusBreakerView().getBus();
+                const auto& bus = vl.getNodeBreakerView().getTerminal(node).get().getBusBreakerView().getBus();
+                BOOST_CHECK_EQUAL(static_cast<bool>(expectedBus), static_cast<bool>(bus));
+                if (static_cast<bool>(expectedBus) && static_cast<bool>(bus)) {
+                    BOOST_CHECK_EQUAL(expectedBus.get().getId(), bus.get().getId());
+                }
+            }
+        }
+    };
+
+    const auto& setOpen = [&](const std::string& switchId, bool open) {
+        network.getSwitch(switchId).setOpen(open);
+        // The expected buses are computed from scratch
+        expected.getSwitch(switchId).setOpen(open);
+        expectedVl.invalidateCache();
+        checkBuses();
+    };
+
+    checkBuses();
+    const Bus& gh1Bus = vl.getBusBreakerView().getBus2("S1VL2_GH1_BREAKER").get();
+    const Bus& gh2Bus = vl.getBusBreakerView().getBus2("S1VL2_GH2_BREAKER").get();
+
+    // Isolate the node between the disconnectors and the breaker of GH1
+    setOpen("S1VL2_BBS1_GH1_DISCONNECTOR", true);
+    BOOST_CHECK_EQUAL("S1VL2_6", vl.getBusBreakerView().getBus1("S1VL2_GH1_BREAKER").get().getId());
+
+    // The buses which do not contain the nodes of the switch are kept
+    BOOST_CHECK(stdcxx::areSame(gh1Bus, vl.getBusBreakerView().getBus2("S1VL2_GH1_BREAKER").get()));
+    BOOST_CHECK(stdcxx::areSame(gh2Bus, vl.getBusBreakerView().getBus2("S1VL2_GH2_BREAKER").get()));
+    BOOST_CHECK_EQUAL("S1VL2_0", vl.getBusBreakerView().getBus1("S1VL2_GH2_BREAKER").get().getId());
+
+    // Merge the two busbar sections
+    setOpen("S1VL2_BBS2_GH1_DISCONNECTOR", false);
+    setOpen("S1VL2_BBS1_GH1_DISCONNECTOR", false);
+    BOOST_CHECK_EQUAL(vl.getBusBreakerView().getBus1("S1VL2_GH1_BREAKER").get().getId(), vl.getBusBreakerView().getBus1("S1VL2_GH2_BREAKER").get().getId());
+
+    // Retained switches do not change the buses of the bus/breaker view
+    setOpen("S1VL2_GH1_BREAKER", true);
+    BOOST_CHECK(stdcxx::areSame(gh1Bus, vl.getBusBreakerView().getBus2("S1VL2_GH1_BREAKER").get()));
+    BOOST_CHECK(!network.getGenerator("GH1").getTerminal().getBusView().getBus());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace iidm
@@ -7,10 +7,15 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <powsybl/AssertionError.hpp>
+#include <powsybl/iidm/Generator.hpp>
 #include <powsybl/iidm/MinMaxReactiveLimits.hpp>
+#include <powsybl/iidm/Network.hpp>
 #include <powsybl/iidm/ReactiveLimitsHolder.hpp>
 #include <powsybl/iidm/Validable.hpp>
 #include <powsybl/iidm/ValidationException.hpp>
+#include <powsybl/iidm/util/ReactiveLimitsEvaluator.hpp>
+#include <powsybl/network/FourSubstationsNodeBreakerFactory.hpp>
 #include <powsybl/stdcxx/math.hpp>
 
 #include <powsybl/test/AssertionUtils.hpp>
@@ -119,6 +124,68 @@ BOOST_AUTO_TEST_CASE(ReactiveCapabilityCurveTest) {
         ++itE;
     }
     BOOST_CHECK(itE == expected.end());
+    BOOST_CHECK_CLOSE(-10.0, limits.getMinQ(stdcxx::nan()), std::numeric_limits<double>::epsilon());
+}
+
+BOOST_AUTO_TEST_CASE(ReactiveLimitsEvaluatorTest) {
+    Network network = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    network.getGenerator("GH1").newMinMaxReactiveLimits()
+        .setMinQ(-100.0)
+        .setMaxQ(200.0)
+        .add();
+    network.getGenerator("GH2").newReactiveCapabilityCurve()
+        .beginPoint()
+        .setP(0.0)
+        .setMinQ(-500.0)
+        .setMaxQ(500.0)
+        .endPoint()
+        .beginPoint()
+        .setP(55.5)
+        .setMinQ(-400.0)
+        .setMaxQ(450.0)
+        .endPoint()
+        .beginPoint()
+        .setP(150.0)
+        .setMinQ(-100.0)
+        .setMaxQ(100.0)
+        .endPoint()
+        .add();
+
+    ReactiveLimitsEvaluator evaluator(network);
+    BOOST_CHECK_EQUAL(boost::size(network.getGenerators()), evaluator.getGeneratorCount());
+
+    std::vector<double> minQ;
+    std::vector<double> maxQ;
+    evaluator.getReactiveLimits(minQ, maxQ);
+    BOOST_CHECK_EQUAL(evaluator.getGeneratorCount(), minQ.size());
+    BOOST_CHECK_EQUAL(evaluator.getGeneratorCount(), maxQ.size());
+    for (unsigned long i = 0; i < evaluator.getGeneratorCount(); ++i) {
+        const Generator& generator = evaluator.getGenerator(i);
+        const auto& limits = generator.getReactiveLimits<ReactiveLimits>();
+        BOOST_CHECK_CLOSE(limits.getMinQ(generator.getTargetP()), minQ[i], 1e-9);
+        BOOST_CHECK_CLOSE(limits.getMaxQ(generator.getTargetP()), maxQ[i], 1e-9);
+    }
+
+    // Same results as ReactiveLimits, below, inside and above the curves, and on their points
+    for (double p : {-1000.0, -12.5, 0.0, 10.0, 55.5, 100.0, 150.0, 300.0, 1000.0, stdcxx::nan()}) {
+        std::vector<double> values(evaluator.getGeneratorCount(), p);
+        evaluator.getReactiveLimits(values, minQ, maxQ);
+        for (unsigned long i = 0; i < evaluator.getGeneratorCount(); ++i) {
+            const auto& limits = evaluator.getGenerator(i).getReactiveLimits<ReactiveLimits>();
+            BOOST_CHECK_CLOSE(limits.getMinQ(p), minQ[i], 1e-9);
+            BOOST_CHECK_CLOSE(limits.getMaxQ(p), maxQ[i], 1e-9);
+        }
+    }
+
+    const auto& hydro = network.getGenerator("GH1").getReactiveLimits<MinMaxReactiveLimits>();
+    unsigned long index = 0;
+    while (evaluator.getGenerator(index).getId() != "GH1") {
+        ++index;
+    }
+    BOOST_CHECK_CLOSE(hydro.getMinQ(), minQ[index], std::numeric_limits<double>::epsilon());
+    BOOST_CHECK_CLOSE(hydro.getMaxQ(), maxQ[index], std::numeric_limits<double>::epsilon());
+
+    POWSYBL_ASSERT_THROW(evaluator.getReactiveLimits(std::vector<double>(1, 0.0), minQ, maxQ), AssertionError, "Unexpected active power count: 1 (expected: 5)");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
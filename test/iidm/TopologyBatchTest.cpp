@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <powsybl/PowsyblException.hpp>
+#include <powsybl/iidm/Generator.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/Switch.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/iidm/TopologyBatch.hpp>
+#include <powsybl/iidm/VariantManager.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/network/FourSubstationsNodeBreakerFactory.hpp>
+
+#include <powsybl/test/AssertionUtils.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+BOOST_AUTO_TEST_SUITE(TopologyBatchTestSuite)
+
+BOOST_AUTO_TEST_CASE(deferredInvalidation) {
+    Network network = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    const VoltageLevel& vl = network.getVoltageLevel("S1VL2");
+    const VoltageLevel& otherVl = network.getVoltageLevel("S3VL1");
+    Terminal& gh1 = network.getGenerator("GH1").getTerminal();
+    Terminal& gh2 = network.getGenerator("GH2").getTerminal();
+    BOOST_CHECK(gh1.isConnected());
+    BOOST_CHECK(gh2.isConnected());
+
+    const unsigned long networkGeneration = network.getTopologyGeneration();
+    const unsigned long generation = vl.getTopologyGeneration();
+    const unsigned long otherGeneration = otherVl.getTopologyGeneration();
+    {
+        TopologyBatch batch(network);
+        BOOST_CHECK(network.isInTopologyBatch());
+        network.getSwitch("S1VL2_GH1_BREAKER").setOpen(true);
+        network.getSwitch("S1VL2_GH2_BREAKER").setOpen(true);
+        network.getSwitch("S1VL2_GH2_BREAKER").setOpen(false);
+        BOOST_CHECK_EQUAL(generation, vl.getTopologyGeneration());
+        BOOST_CHECK_EQUAL(networkGeneration, network.getTopologyGeneration());
+
+        // Reading the topology of the voltage level applies its deferred invalidation
+        BOOST_CHECK(!gh1.isConnected());
+        BOOST_CHECK(gh2.isConnected());
+        BOOST_CHECK_EQUAL(generation + 1, vl.getTopologyGeneration());
+
+        // Disconnecting GH2 reads the topology modified by the connection of GH1
+        BOOST_CHECK(gh1.connect());
+        BOOST_CHECK(gh2.disconnect());
+        BOOST_CHECK_EQUAL(generation + 2, vl.getTopologyGeneration());
+    }
+    BOOST_CHECK(!network.isInTopologyBatch());
+    BOOST_CHECK_EQUAL(generation + 3, vl.getTopologyGeneration());
+    BOOST_CHECK_EQUAL(otherGeneration, otherVl.getTopologyGeneration());
+    BOOST_CHECK_EQUAL(networkGeneration + 3, network.getTopologyGeneration());
+    BOOST_CHECK(gh1.isConnected());
+    BOOST_CHECK(!gh2.isConnected());
+}
+
+BOOST_AUTO_TEST_CASE(networkViews) {
+    Network network = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    Terminal& gh1 = network.getGenerator("GH1").getTerminal();
+    const std::string& busId = gh1.getBusView().getBus().get().getId();
+    BOOST_CHECK(network.getBusView().getBus(busId));
+
+    TopologyBatch batch(network);
+    network.getSwitch("S1VL2_BBS1_TWT_DISCONNECTOR").setOpen(true);
+    network.getSwitch("S1VL2_VSC1_BREAKER").setOpen(true);
+    network.getSwitch("S1VL2_GH1_BREAKER").setOpen(true);
+    network.getSwitch("S1VL2_GH2_BREAKER").setOpen(true);
+
+    // The network-wide views apply the deferred invalidations before being read
+    BOOST_CHECK(!gh1.getBusView().getBus());
+    BOOST_CHECK(network.getBusView().getBus(busId));
+    batch.commit();
+    BOOST_CHECK(batch.isCommitted());
+    POWSYBL_ASSERT_THROW(batch.commit(), PowsyblException, "Topology batch already committed");
+}
+
+BOOST_AUTO_TEST_CASE(nestedBatchesAndVariants) {
+    Network network = powsybl::network::FourSubstationsNodeBreakerFactory::create();
+    const VoltageLevel& vl = network.getVoltageLevel("S1VL2");
+    Terminal& gh1 = network.getGenerator("GH1").getTerminal();
+    network.getVariantManager().cloneVariant(VariantManager::getInitialVariantId(), "v");
+    const unsigned long generation = vl.getTopologyGeneration();
+
+    TopologyBatch batch(network);
+    {
+        TopologyBatch nestedBatch(network);
+        network.getSwitch("S1VL2_GH1_BREAKER").setOpen(true);
+        network.getVariantManager().setWorkingVariant("v");
+        network.getSwitch("S1VL2_GH1_BREAKER").setOpen(true);
+    }
+    BOOST_CHECK(network.isInTopologyBatch());
+    BOOST_CHECK_EQUAL(generation, vl.getTopologyGeneration());
+    batch.commit();
+    BOOST_CHECK(!network.isInTopologyBatch());
+
+    // Both variants have been invalidated
+    BOOST_CHECK_EQUAL(generation + 2, vl.getTopologyGeneration());
+    BOOST_CHECK(!gh1.isConnected());
+    network.getVariantManager().setWorkingVariant(VariantManager::getInitialVariantId());
+    BOOST_CHECK(!gh1.isConnected());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace iidm
+
+}  // namespace powsybl
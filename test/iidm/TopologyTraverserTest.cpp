@@ -11,6 +11,7 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <powsybl/iidm/BusAdder.hpp>
 #include <powsybl/iidm/BusbarSection.hpp>
 #include <powsybl/iidm/Generator.hpp>
 #include <powsybl/iidm/Line.hpp>
@@ -18,10 +19,13 @@
 #include <powsybl/iidm/Load.hpp>
 #include <powsybl/iidm/LoadAdder.hpp>
 #include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/Substation.hpp>
+#include <powsybl/iidm/SubstationAdder.hpp>
 #include <powsybl/iidm/Switch.hpp>
 #include <powsybl/iidm/Terminal.hpp>
 #include <powsybl/iidm/TwoWindingsTransformerAdder.hpp>
 #include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/iidm/VoltageLevelAdder.hpp>
 #include <powsybl/network/EurostagFactory.hpp>
 #include <powsybl/network/FictitiousSwitchFactory.hpp>
 
@@ -246,6 +250,48 @@ BOOST_AUTO_TEST_CASE(testTraversalOrder) {
     BOOST_CHECK_EQUAL_COLLECTIONS(expectedVisited.begin(), expectedVisited.end(), visited.begin(), visited.end());
 }
 
+BOOST_AUTO_TEST_CASE(testLongChain) {
+    // A long chain of voltage levels must not exhaust the stack
+    const unsigned long voltageLevelCount = 5000;
+
+    Network network("test", "test");
+    Substation& substation = network.newSubstation()
+        .setId("S")
+        .add();
+    for (unsigned long i = 0; i < voltageLevelCount; ++i) {
+        const std::string& index = std::to_string(i);
+        VoltageLevel& voltageLevel = substation.newVoltageLevel()
+            .setId("VL" + index)
+            .setNominalV(400.0)
+            .setTopologyKind(TopologyKind::BUS_BREAKER)
+            .add();
+        voltageLevel.getBusBreakerView().newBus()
+            .setId("B" + index)
+            .add();
+        if (i > 0) {
+            const std::string& previousIndex = std::to_string(i - 1);
+            network.newLine()
+                .setId("L" + index)
+                .setVoltageLevel1("VL" + previousIndex)
+                .setBus1("B" + previousIndex)
+                .setConnectableBus1("B" + previousIndex)
+                .setVoltageLevel2("VL" + index)
+                .setBus2("B" + index)
+                .setConnectableBus2("B" + index)
+                .setR(1.0)
+                .setX(1.0)
+                .setG1(0.0)
+                .setB1(0.0)
+                .setG2(0.0)
+                .setB2(0.0)
+                .add();
+        }
+    }
+
+    const auto& visited = getVisitedList(network.getLine("L1").getTerminal1());
+    BOOST_CHECK_EQUAL(2 * (voltageLevelCount - 1), visited.size());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace iidm
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <powsybl/PowsyblException.hpp>
+#include <powsybl/iidm/Line.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/RatioTapChanger.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/iidm/TwoWindingsTransformer.hpp>
+#include <powsybl/iidm/util/AdmittanceMatrix.hpp>
+#include <powsybl/iidm/util/LinkData.hpp>
+#include <powsybl/network/EurostagFactory.hpp>
+#include <powsybl/network/ThreeWindingsTransformerNetworkFactory.hpp>
+#include <powsybl/test/AssertionUtils.hpp>
+
+namespace powsybl {
+
+namespace iidm {
+
+void checkClose(const std::complex<double>& expected, const std::complex<double>& actual) {
+    const double tol = 1e-9;
+    BOOST_CHECK_CLOSE(std::real(expected), std::real(actual), tol);
+    BOOST_CHECK_CLOSE(std::imag(expected), std::imag(actual), tol);
+}
+
+BOOST_AUTO_TEST_SUITE(AdmittanceMatrixTestSuite)
+
+BOOST_AUTO_TEST_CASE(calculateBranchAdmittances) {
+    LinkData::BranchAdmittanceParameters parameters;
+    parameters.resize(3);
+    parameters.r = {0.15, 0.0, 1.2};
+    parameters.x = {0.25, 0.0, 12.5};
+    parameters.ratio1 = {1.0, 1.0, 0.95};
+    parameters.angle1 = {0.0, 0.0, -0.1};
+    parameters.g1 = {0.01, 0.02, 1e-5};
+    parameters.b1 = {0.002, 0.001, 2e-4};
+    parameters.g2 = {0.01, 0.0, 0.0};
+    parameters.b2 = {0.002, 0.003, 0.0};
+
+    std::vector<LinkData::BranchAdmittanceMatrix> admittances(parameters.size());
+    LinkData::calculateBranchAdmittances(parameters, 0, parameters.size(), admittances);
+
+    for (unsigned long i = 0; i < parameters.size(); ++i) {
+        const auto& expected = LinkData::calculateBranchAdmittance(parameters.r[i], parameters.x[i], parameters.ratio1[i], parameters.angle1[i],
+                                                                   parameters.ratio2[i], parameters.angle2[i],
+                                                                   std::complex<double>(parameters.g1[i], parameters.b1[i]),
+                                                                   std::complex<double>(parameters.g2[i], parameters.b2[i]));
+        checkClose(expected.y11, admittances[i].y11);
+        checkClose(expected.y12, admittances[i].y12);
+        checkClose(expected.y21, admittances[i].y21);
+        checkClose(expected.y22, admittances[i].y22);
+    }
+
+    POWSYBL_ASSERT_THROW(LinkData::calculateBranchAdmittances(parameters, 0, 4, admittances), AssertionError, "Invalid branch range [0, 4) (size: 3)");
+}
+
+BOOST_AUTO_TEST_CASE(network) {
+    Network network = powsybl::network::EurostagFactory::createTutorial1Network();
+
+    AdmittanceMatrix matrix(network);
+    BOOST_CHECK_EQUAL(4UL, matrix.getBusCount());
+    BOOST_CHECK_EQUAL(4UL, matrix.getSize());
+    BOOST_CHECK_EQUAL(5UL, matrix.getRowOffsets().size());
+    // 4 diagonal terms + 3 pairs of off-diagonal terms
+    BOOST_CHECK_EQUAL(10UL, matrix.getColumnIndices().size());
+    BOOST_CHECK_EQUAL(10UL, matrix.getValues().size());
+    POWSYBL_ASSERT_THROW(matrix.getBusIndex("UNKNOWN"), PowsyblException, "Bus UNKNOWN not found");
+    POWSYBL_ASSERT_THROW(matrix.get(4, 0), PowsyblException, "Invalid matrix position (4, 0): size is 4");
+
+    unsigned long gen = matrix.getBusIndex(network.getLine("NHV1_NHV2_1").getTerminal1().getBusView().getBus().get().getId());
+    unsigned long hv1 = matrix.getBusIndex(network.getTwoWindingsTransformer("NGEN_NHV1").getTerminal2().getBusView().getBus().get().getId());
+    unsigned long hv2 = matrix.getBusIndex(network.getLine("NHV1_NHV2_1").getTerminal2().getBusView().getBus().get().getId());
+    BOOST_CHECK_EQUAL(gen, hv1);
+    BOOST_CHECK_NE(hv1, hv2);
+
+    const Line& line = network.getLine("NHV1_NHV2_1");
+    const auto& lineAdm = LinkData::calculateBranchAdmittance(line.getR(), line.getX(), 1.0, 0.0, 1.0, 0.0,
+                                                              std::complex<double>(line.getG1(), line.getB1()),
+                                                              std::complex<double>(line.getG2(), line.getB2()));
+    // Both lines are identical
+    checkClose(2.0 * lineAdm.y12, matrix.get(hv1, hv2));
+    checkClose(2.0 * lineAdm.y21, matrix.get(hv2, hv1));
+
+    unsigned long load = matrix.getBusIndex(network.getTwoWindingsTransformer("NHV2_NLOAD").getTerminal2().getBusView().getBus().get().getId());
+    BOOST_CHECK_EQUAL(std::complex<double>(), matrix.get(hv1, load));
+
+    TwoWindingsTransformer& twt = network.getTwoWindingsTransformer("NHV2_NLOAD");
+    double rho = twt.getRatedU2() / twt.getRatedU1() * twt.getRatioTapChanger().getCurrentStep().getRho();
+    auto twtAdm = LinkData::calculateBranchAdmittance(twt.getR(), twt.getX(), 1 / rho, 0.0, 1.0, 0.0,
+                                                      std::complex<double>(twt.getG(), twt.getB()), std::complex<double>());
+    checkClose(twtAdm.y12, matrix.get(hv2, load));
+    checkClose(twtAdm.y22, matrix.get(load, load));
+
+    // Only the transformers are updated
+    twt.getRatioTapChanger().setTapPosition(2);
+    matrix.updateTapPositions();
+    rho = twt.getRatedU2() / twt.getRatedU1() * twt.getRatioTapChanger().getCurrentStep().getRho();
+    twtAdm = LinkData::calculateBranchAdmittance(twt.getR(), twt.getX(), 1 / rho, 0.0, 1.0, 0.0,
+                                                 std::complex<double>(twt.getG(), twt.getB()), std::complex<double>());
+    checkClose(twtAdm.y12, matrix.get(hv2, load));
+    checkClose(2.0 * lineAdm.y12, matrix.get(hv1, hv2));
+
+    // Disconnected branches are ignored
+    network.getLine("NHV1_NHV2_2").getTerminal1().disconnect();
+    AdmittanceMatrix matrix2(network);
+    checkClose(lineAdm.y12, matrix2.get(hv1, hv2));
+}
+
+BOOST_AUTO_TEST_CASE(threeWindingsTransformer) {
+    Network network = powsybl::network::ThreeWindingsTransformerNetworkFactory::create();
+
+    AdmittanceMatrix matrix(network);
+    BOOST_CHECK_EQUAL(3UL, matrix.getBusCount());
+    BOOST_CHECK_EQUAL(4UL, matrix.getSize());
+
+    // The star bus is connected to each leg, the buses are not connected together
+    unsigned long star = 3;
+    for (unsigned long bus = 0; bus < matrix.getBusCount(); ++bus) {
+        BOOST_CHECK_NE(std::complex<double>(), matrix.get(bus, star));
+        BOOST_CHECK_NE(std::complex<double>(), matrix.get(star, bus));
+        for (unsigned long other = 0; other < matrix.getBusCount(); ++other) {
+            if (other != bus) {
+                BOOST_CHECK_EQUAL(std::complex<double>(), matrix.get(bus, other));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace iidm
+
+}  // namespace powsybl
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include <powsybl/stdcxx/Arena.hpp>
+
+namespace stdcxx {
+
+BOOST_AUTO_TEST_SUITE(ArenaTestSuite)
+
+BOOST_AUTO_TEST_CASE(allocate) {
+    Arena arena(16, 64);
+    BOOST_CHECK_EQUAL(0UL, arena.getBlockCount());
+    BOOST_CHECK_EQUAL(0UL, arena.getUsedSize());
+
+    void* ptr1 = arena.allocate(1, 1);
+    void* ptr2 = arena.allocate(8, 8);
+    BOOST_CHECK_EQUAL(1UL, arena.getBlockCount());
+    BOOST_CHECK_EQUAL(0UL, reinterpret_cast<std::uintptr_t>(ptr2) % 8);
+    BOOST_CHECK(ptr1 != ptr2);
+    // 1 byte, 7 bytes of padding and 8 bytes
+    BOOST_CHECK_EQUAL(16UL, arena.getUsedSize());
+
+    // The block is full: a new block of twice the size is allocated
+    arena.allocate(8, 8);
+    BOOST_CHECK_EQUAL(2UL, arena.getBlockCount());
+
+    // An area larger than the next block gets its own block
+    arena.allocate(256, 8);
+    BOOST_CHECK_EQUAL(3UL, arena.getBlockCount());
+    BOOST_CHECK_EQUAL(280UL, arena.getUsedSize());
+
+    BOOST_CHECK_THROW(arena.allocate(8, 0), std::invalid_argument);
+    BOOST_CHECK_THROW(arena.allocate(8, 3), std::invalid_argument);
+    BOOST_CHECK_THROW(arena.allocate(8, 2 * alignof(std::max_align_t)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(create) {
+    Arena arena;
+
+    std::string* str = arena.create<std::string>("value");
+    BOOST_CHECK_EQUAL("value", *str);
+    str->~basic_string();
+
+    double* value = arena.create<double>(1.5);
+    BOOST_CHECK_EQUAL(1.5, *value);
+}
+
+BOOST_AUTO_TEST_CASE(move) {
+    Arena arena(16, 16);
+    double* value = arena.create<double>(1.5);
+
+    Arena movedArena(std::move(arena));
+    BOOST_CHECK_EQUAL(1.5, *value);
+    BOOST_CHECK_EQUAL(1UL, movedArena.getBlockCount());
+    BOOST_CHECK_EQUAL(8UL, movedArena.getUsedSize());
+
+    // The moved arena does not give memory from the blocks of the other one anymore
+    BOOST_CHECK_EQUAL(0UL, arena.getBlockCount());
+    BOOST_CHECK_EQUAL(0UL, arena.getUsedSize());
+    arena.create<double>(2.5);
+    BOOST_CHECK_EQUAL(1UL, arena.getBlockCount());
+    BOOST_CHECK_EQUAL(1.5, *value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace stdcxx
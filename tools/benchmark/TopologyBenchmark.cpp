@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2026, RTE (http://www.rte-france.com)
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <chrono>
+#include <iostream>
+
+#include <boost/program_options.hpp>
+
+#include <powsybl/PowsyblException.hpp>
+#include <powsybl/iidm/Bus.hpp>
+#include <powsybl/iidm/BusbarSectionAdder.hpp>
+#include <powsybl/iidm/Load.hpp>
+#include <powsybl/iidm/LoadAdder.hpp>
+#include <powsybl/iidm/Network.hpp>
+#include <powsybl/iidm/Substation.hpp>
+#include <powsybl/iidm/SubstationAdder.hpp>
+#include <powsybl/iidm/Switch.hpp>
+#include <powsybl/iidm/SwitchAdder.hpp>
+#include <powsybl/iidm/Terminal.hpp>
+#include <powsybl/iidm/VoltageLevel.hpp>
+#include <powsybl/iidm/VoltageLevelAdder.hpp>
+#include <powsybl/stdcxx/format.hpp>
+
+/**
+ * Create a network made of voltage levels built like the voltage level S1VL2 of FourSubstationsNodeBreakerFactory:
+ * two busbar sections, a coupler and bays made of a disconnector to each busbar section and a retained breaker. The
+ * bays are connected to the first busbar section.
+ */
+powsybl::iidm::Network createNetwork(unsigned long voltageLevelCount, unsigned long bayCount) {
+    using namespace powsybl::iidm;
+
+    const auto& createSwitch = [](VoltageLevel& vl, const std::string& id, const SwitchKind& kind, bool open, unsigned long node1, unsigned long node2) {
+        vl.getNodeBreakerView().newSwitch()
+            .setId(id)
+            .setKind(kind)
+            .setRetained(kind == SwitchKind::BREAKER)
+            .setOpen(open)
+            .setNode1(node1)
+            .setNode2(node2)
+            .add();
+    };
+
+    Network network("topologyBenchmark", "test");
+    for (unsigned long i = 0; i < voltageLevelCount; ++i) {
+        Substation& substation = network.newSubstation()
+            .setId(stdcxx::format("S%1%", i))
+            .add();
+        VoltageLevel& vl = substation.newVoltageLevel()
+            .setId(stdcxx::format("S%1%VL", i))
+            .setNominalV(400.0)
+            .setTopologyKind(TopologyKind::NODE_BREAKER)
+            .add();
+        vl.getNodeBreakerView().newBusbarSection()
+            .setId(stdcxx::format("%1%_BBS1", vl.getId()))
+            .setNode(0)
+            .add();
+        vl.getNodeBreakerView().newBusbarSection()
+            .setId(stdcxx::format("%1%_BBS2", vl.getId()))
+            .setNode(1)
+            .add();
+        createSwitch(vl, stdcxx::format("%1%_BBS1_COUPLER_DISCONNECTOR", vl.getId()), SwitchKind::DISCONNECTOR, false, 0, 2);
+        createSwitch(vl, stdcxx::format("%1%_BBS2_COUPLER_DISCONNECTOR", vl.getId()), SwitchKind::DISCONNECTOR, false, 1, 3);
+        createSwitch(vl, stdcxx::format("%1%_COUPLER", vl.getId()), SwitchKind::BREAKER, false, 2, 3);
+
+        for (unsigned long j = 0; j < bayCount; ++j) {
+            const unsigned long node = 4 + 2 * j;
+            const std::string& bayId = stdcxx::format("%1%_LD%2%", vl.getId(), j);
+            createSwitch(vl, stdcxx::format("%1%_BBS1_DISCONNECTOR", bayId), SwitchKind::DISCONNECTOR, false, 0, node);
+            createSwitch(vl, stdcxx::format("%1%_BBS2_DISCONNECTOR", bayId), SwitchKind::DISCONNECTOR, true, 1, node);
+            createSwitch(vl, stdcxx::format("%1%_BREAKER", bayId), SwitchKind::BREAKER, false, node, node + 1);
+            vl.newLoad()
+                .setId(bayId)
+                .setNode(node + 1)
+                .setLoadType(LoadType::UNDEFINED)
+                .setP0(10.0)
+                .setQ0(1.0)
+                .add();
+        }
+    }
+
+    return network;
+}
+
+/**
+ * Move bays from one busbar section to the other and read the bus/breaker view bus of their load after each move.
+ * If fullUpdate is true, the calculated topology is dropped after each move, as before incremental updates.
+ */
+double run(powsybl::iidm::Network& network, unsigned long voltageLevelCount, unsigned long bayCount, unsigned long iterationCount, bool fullUpdate) {
+    using namespace powsybl::iidm;
+
+    const auto& start = std::chrono::steady_clock::now();
+    for (unsigned long k = 0; k < iterationCount; ++k) {
+        VoltageLevel& vl = network.getVoltageLevel(stdcxx::format("S%1%VL", k % voltageLevelCount));
+        const std::string& bayId = stdcxx::format("%1%_LD%2%", vl.getId(), (k / voltageLevelCount) % bayCount);
+        Switch& disconnector1 = network.getSwitch(stdcxx::format("%1%_BBS1_DISCONNECTOR", bayId));
+        Switch& disconnector2 = network.getSwitch(stdcxx::format("%1%_BBS2_DISCONNECTOR", bayId));
+
+        // Close the other disconnector first, as an operator would do
+        disconnector2.setOpen(!disconnector2.isOpen());
+        disconnector1.setOpen(!disconnector1.isOpen());
+        if (fullUpdate) {
+            vl.invalidateCache();
+        }
+
+        const auto& bus = network.getLoad(bayId).getTerminal().getBusBreakerView().getBus();
+        if (!bus) {
+            throw powsybl::PowsyblException(stdcxx::format("Load %1% is not connected", bayId));
+        }
+    }
+    const std::chrono::duration<double, std::milli>& duration = std::chrono::steady_clock::now() - start;
+
+    return duration.count();
+}
+
+int main(int argc, char** argv) {
+    const char* const VOLTAGE_LEVEL_COUNT = "voltage-levels";
+    const char* const BAY_COUNT = "bays";
+    const char* const ITERATION_COUNT = "iterations";
+
+    boost::program_options::options_description desc("Options");
+    desc.add_options()
+        (VOLTAGE_LEVEL_COUNT, boost::program_options::value<unsigned long>()->default_value(100))
+        (BAY_COUNT, boost::program_options::value<unsigned long>()->default_value(50))
+        (ITERATION_COUNT, boost::program_options::value<unsigned long>()->default_value(10000));
+
+    try {
+        boost::program_options::variables_map vm;
+        boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+        boost::program_options::notify(vm);
+
+        const unsigned long voltageLevelCount = vm[VOLTAGE_LEVEL_COUNT].as<unsigned long>();
+        const unsigned long bayCount = vm[BAY_COUNT].as<unsigned long>();
+        const unsigned long iterationCount = vm[ITERATION_COUNT].as<unsigned long>();
+        if (voltageLevelCount == 0 || bayCount == 0) {
+            throw powsybl::PowsyblException("Voltage level and bay counts must be > 0");
+        }
+
+        powsybl::iidm::Network network = createNetwork(voltageLevelCount, bayCount);
+        std::cout << stdcxx::format("%1% voltage levels of %2% bays, %3% bay moves", voltageLevelCount, bayCount, iterationCount) << std::endl;
+        std::cout << stdcxx::format("Full update:        %1% ms", run(network, voltageLevelCount, bayCount, iterationCount, true)) << std::endl;
+        std::cout << stdcxx::format("Incremental update: %1% ms", run(network, voltageLevelCount, bayCount, iterationCount, false)) << std::endl;
+
+    } catch (const boost::program_options::error& e) {
+        std::cerr << "ERROR: " << e.what() << "\n\n";
+        std::cerr << desc << '\n' << std::flush;
+        return EXIT_FAILURE;
+    } catch (const powsybl::PowsyblException& e) {
+        std::cerr << "ERROR: " << e.what() << "\n\n" << std::flush;
+        return EXIT_FAILURE;
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n\n" << std::flush;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "ERROR: unexpected exception" << "\n\n" << std::flush;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}